@@ -15,12 +15,15 @@
 #include <stdbool.h>
 #include <string.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 
 // log module
 #include <log/log.h>
 
-// Debug mode
-#undef NDEBUG
+// Debug mode. Release builds define TUPLE_RELEASE, and leave NDEBUG to the build
+#ifndef TUPLE_RELEASE
+    #undef NDEBUG
+#endif
 
 // Platform dependent macros
 #ifdef _WIN64
@@ -34,8 +37,51 @@
 #define TUPLE_REALLOC(p, sz) realloc(p,sz)
 #endif
 
+// Inline tuples
+#define TUPLE_INLINE_SIZE     64                                          // One cache line
+#define TUPLE_INLINE_CAPACITY ( ( TUPLE_INLINE_SIZE - sizeof(size_t) - ( 2 * sizeof(unsigned int) ) ) / sizeof(void *) ) // Room left after the tuple header
+
 // Forward declarations
 struct tuple_s;
+struct tuple_pool_s;
+struct tuple_arena_s;
+
+// Enumeration definitions
+enum tuple_status_e
+{
+    TUPLE_STATUS_OK = 0,             // No error
+    TUPLE_STATUS_NO_TUPLE,           // Null pointer provided for a tuple parameter
+    TUPLE_STATUS_NO_ELEMENTS,        // Null element array, or no elements, provided to a constructor
+    TUPLE_STATUS_NO_VALUE,           // Null pointer provided for a return parameter
+    TUPLE_STATUS_NO_FUNCTION,        // Null pointer provided for a function parameter
+    TUPLE_STATUS_NO_STORAGE,         // Null pointer provided for caller provided storage
+    TUPLE_STATUS_NO_VIEW,            // Null pointer provided for a view parameter
+    TUPLE_STATUS_NO_POOL,            // Null pointer provided for a pool parameter
+    TUPLE_STATUS_NO_ARENA,           // Null pointer provided for an arena parameter
+    TUPLE_STATUS_EMPTY,              // The tuple has no elements
+    TUPLE_STATUS_BOUNDS_ERROR,       // Index out of bounds
+    TUPLE_STATUS_LOWER_BOUND,        // Lower bound out of bounds
+    TUPLE_STATUS_UPPER_BOUND,        // Upper bound out of bounds, or less than the lower bound
+    TUPLE_STATUS_TOO_MANY_ELEMENTS,  // More elements than the destination can hold
+    TUPLE_STATUS_NO_MEM,             // Failed to allocate memory
+    TUPLE_STATUS_SYNC_ERROR,         // A sync primitive failed
+    TUPLE_STATUS_NOT_READING,        // tuple_read_exit without a matching tuple_read_enter
+    TUPLE_STATUS_NO_TABLE,           // Null pointer provided for a table parameter
+    TUPLE_STATUS_NO_ROW,             // Null pointer provided for a row parameter
+    TUPLE_STATUS_ARITY_MISMATCH,     // A tuple's size does not match a table's arity
+    TUPLE_STATUS_NO_BUILDER,         // Null pointer provided for a builder parameter
+    TUPLE_STATUS_READ_ONLY,          // A persistent or borrowed tuple can not be updated in place
+    TUPLE_STATUS_BAD_ORDER,          // The memory order is not valid for the operation
+    TUPLE_STATUS_NO_PIPELINE,        // Null pointer provided for a pipeline parameter
+    TUPLE_STATUS_NO_KEYS,            // Null pointer, or no keys, provided for a sort or a join
+    TUPLE_STATUS_BAD_JOIN            // The join mode is not valid
+};
+
+enum tuple_join_mode_e
+{
+    TUPLE_JOIN_INNER = 0, // One result for each pair of tuples whose keys match
+    TUPLE_JOIN_LEFT       // As inner, plus every left tuple that matched nothing, padded with null pointers
+};
 
 // Type definitions
 /** !
@@ -43,6 +89,93 @@ struct tuple_s;
  */
 typedef struct tuple_s tuple;
 
+/** !
+ *  @brief Why the most recent failing call on a thread failed
+ */
+typedef enum tuple_status_e tuple_status;
+
+/** !
+ *  @brief Which tuples a join produces
+ */
+typedef enum tuple_join_mode_e tuple_join_mode;
+
+/** !
+ *  @brief Caller provided storage for a tuple of up to TUPLE_INLINE_CAPACITY elements. It is
+ *         one cache line, aligned to a cache line, so it can live on the stack or inside
+ *         another struct with no heap allocation
+ */
+typedef struct { _Alignas(TUPLE_INLINE_SIZE) unsigned char _storage[TUPLE_INLINE_SIZE]; } tuple_inline;
+
+/** !
+ *  @brief A borrowed window of length elements, starting at offset, over an existing tuple.
+ *         Views are passed by value and never allocate. A view is valid for as long as the
+ *         tuple it borrows from
+ */
+typedef struct
+{
+    const tuple *p_tuple; // The tuple being viewed
+    size_t       offset;  // Index of the first element in the view
+    size_t       length;  // Quantity of elements in the view
+} tuple_view;
+
+/** !
+ *  @brief The type definition of a columnar tuple table. A table stores rows of the same
+ *         arity as one contiguous array per column
+ */
+typedef struct tuple_table_s tuple_table;
+
+/** !
+ *  @brief A handle to one row of a tuple table. Rows are passed by value and never allocate.
+ *         A row is valid until its table is destroyed
+ */
+typedef struct
+{
+    const tuple_table *p_table; // The table the row is in
+    size_t             row;     // Index of the row
+} tuple_row;
+
+/** !
+ *  @brief The type definition of a tuple pool. A pool keeps slabs of fixed size blocks for
+ *         each arity from 0 to 16, then for each power of two up to 65536 elements
+ */
+typedef struct tuple_pool_s tuple_pool;
+
+/** !
+ *  @brief The type definition of a tuple arena. An arena bump allocates tuples of any size
+ *         from large chunks, and releases all of them at once
+ */
+typedef struct tuple_arena_s tuple_arena;
+
+/** !
+ *  @brief The type definition of a tuple intern table. An intern table keeps one canonical
+ *         tuple for each distinct sequence of elements
+ */
+typedef struct tuple_intern_table_s tuple_intern_table;
+
+/** !
+ *  @brief The type definition of a tuple builder. A builder collects elements one at a time,
+ *         when the size of the tuple is not known up front
+ */
+typedef struct tuple_builder_s tuple_builder;
+
+/** !
+ *  @brief The type definition of a tuple pipeline. A pipeline records map and filter stages
+ *         over a tuple, and runs them all in one pass when it is collected or reduced
+ */
+typedef struct tuple_pipeline_s tuple_pipeline;
+
+/** !
+ *  @brief One key of a sort. Tuples are ordered by the element at index, compared with
+ *         pfn_compare, or by address when pfn_compare is null. A negative index counts
+ *         from the end of each tuple
+ */
+typedef struct
+{
+    signed long long   index;                                                   // Position of the key element
+    int              (*pfn_compare)(const void *const a, const void *const b);  // Comparator, or null to order by address
+    bool               descending;                                              // Reverse the order of this key
+} tuple_sort_key;
+
 // Initializers
 /** !
  * This gets called once before main
@@ -53,6 +186,61 @@ typedef struct tuple_s tuple;
 */
 DLLEXPORT void tuple_init ( void ) __attribute__((constructor));
 
+// Errors
+/** !
+ * Get the status of the most recent failing call on the calling thread. Like errno, a
+ * successful call does not clear it
+ * 
+ * @param void
+ * 
+ * @sa tuple_clear_status
+ * 
+ * @return the status, or TUPLE_STATUS_OK if nothing has failed since the last clear
+ */
+DLLEXPORT tuple_status tuple_last_status ( void );
+
+/** !
+ * Set the calling thread's status back to TUPLE_STATUS_OK
+ * 
+ * @param void
+ * 
+ * @sa tuple_last_status
+ * 
+ * @return void
+ */
+DLLEXPORT void tuple_clear_status ( void );
+
+/** !
+ * Get a human readable description of a status
+ * 
+ * @param status the status
+ * 
+ * @return a static string
+ */
+DLLEXPORT const char *tuple_status_string ( tuple_status status );
+
+/** !
+ * Opt in to logging failures, at most limit messages per second across all threads. Logging
+ * is off by default. Statuses are always recorded either way
+ * 
+ * @param limit messages per second, or 0 to turn logging off
+ * 
+ * @return void
+ */
+DLLEXPORT void tuple_log_limit ( size_t limit );
+
+/** !
+ * Record a failure for the calling thread, and log it if logging is on and under the rate
+ * limit. The library and the inline accessors in tuple_fast.h report through this function
+ * 
+ * @param status the status
+ * @param format printf style format string
+ * @param ...    format arguments
+ * 
+ * @return void
+ */
+DLLEXPORT void tuple_report ( tuple_status status, const char *const format, ... );
+
 // Allocaters
 /** !
  *  Allocate memory for a tuple
@@ -65,9 +253,91 @@ DLLEXPORT void tuple_init ( void ) __attribute__((constructor));
  */
 DLLEXPORT int tuple_create ( tuple **const pp_tuple );
 
+/** !
+ *  Allocate memory for a tuple pool
+ *
+ * @param pp_pool return
+ *
+ * @sa tuple_pool_attach
+ * @sa tuple_pool_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pool_create ( tuple_pool **const pp_pool );
+
+/** !
+ *  Allocate memory for a tuple arena
+ *
+ * @param pp_arena return
+ *
+ * @sa tuple_arena_attach
+ * @sa tuple_arena_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_arena_create ( tuple_arena **const pp_arena );
+
+/** !
+ *  Allocate memory for a tuple intern table. With no callbacks, tuples are equal when they
+ *  hold the same pointers. With callbacks, tuples are equal when their elements are equal
+ *  by content. The two callbacks must agree, so elements that compare equal hash equal
+ *
+ * @param pp_table return
+ * @param pfn_element_hash pointer to function of type unsigned long long (*)(const void *value), or null
+ * @param pfn_compare pointer to function of type int (*)(const void *a, const void *b), or null
+ *
+ * @sa tuple_intern
+ * @sa tuple_intern_table_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_intern_table_create ( tuple_intern_table **const pp_table, unsigned long long (*const pfn_element_hash)(const void *const value), int (*const pfn_compare)(const void *const a, const void *const b) );
+
+/** !
+ *  Allocate memory for a columnar table of rows with arity elements each
+ *
+ * @param pp_table return
+ * @param arity quantity of elements in every row
+ *
+ * @sa tuple_table_append
+ * @sa tuple_table_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_table_create ( tuple_table **const pp_table, size_t arity );
+
+/** !
+ *  Allocate memory for a tuple builder
+ *
+ * @param pp_builder return
+ * @param capacity elements to make room for up front. The buffer grows past it as needed
+ *
+ * @sa tuple_builder_push
+ * @sa tuple_builder_freeze
+ * @sa tuple_builder_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_builder_create ( tuple_builder **const pp_builder, size_t capacity );
+
+/** !
+ *  Allocate memory for a pipeline over a tuple. The pipeline retains the tuple, and releases
+ *  it when it is destroyed
+ *
+ * @param pp_pipeline return
+ * @param p_source the tuple the pipeline reads
+ *
+ * @sa tuple_pipeline_map
+ * @sa tuple_pipeline_filter
+ * @sa tuple_pipeline_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pipeline_create ( tuple_pipeline **const pp_pipeline, tuple *const p_source );
+
 // Constructors
 /** !
- *  Construct a tuple with a specific size
+ *  Construct a tuple with a specific size. Every element is set to null
  *
  * @param pp_tuple return
  * @param size number of elements in a tuple
@@ -83,7 +353,7 @@ DLLEXPORT int tuple_construct ( tuple **const pp_tuple, size_t size );
  *  Construct a tuple from a list of elements
  *
  * @param pp_tuple return
- * @param elements pointer to null terminated tuple of element pointers
+ * @param elements pointer to an array of at least size element pointers
  * @param size number of elements. 
  *
  * @sa tuple_construct
@@ -109,6 +379,151 @@ DLLEXPORT int tuple_from_elements ( tuple **const pp_tuple, void *const *const e
  */
 DLLEXPORT int tuple_from_arguments ( tuple **const pp_tuple, size_t element_count, ... );
 
+/** !
+ *  Construct many tuples in one allocation. The tuples are laid out back to back after
+ *  their handles, and are valid until tuple_destroy_batch. Calling tuple_destroy on one
+ *  of them only clears the caller's pointer
+ *
+ * @param ppp_tuples return; an array of count tuple pointers
+ * @param elements   pointer to the elements of every tuple, one after another
+ * @param sizes      pointer to an array of count element quantities
+ * @param count      number of tuples
+ *
+ * @sa tuple_from_elements
+ * @sa tuple_destroy_batch
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_from_elements_batch ( tuple ***const ppp_tuples, void *const *const elements, const size_t *const sizes, size_t count );
+
+/** !
+ *  Construct a tuple that takes ownership of an existing element array, without copying it.
+ *  The array must have been allocated with TUPLE_REALLOC, and is freed with the tuple. On
+ *  failure, the caller still owns the array
+ *
+ * @param pp_tuple return
+ * @param elements pointer to an array of size element pointers
+ * @param size number of elements
+ *
+ * @sa tuple_borrow
+ * @sa tuple_detach
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_adopt ( tuple **const pp_tuple, void **const elements, size_t size );
+
+/** !
+ *  Construct a tuple that reads an existing element array, without copying or owning it.
+ *  The tuple is valid for as long as the array is
+ *
+ * @param pp_tuple return
+ * @param elements pointer to an array of size element pointers
+ * @param size number of elements
+ *
+ * @sa tuple_adopt
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_borrow ( tuple **const pp_tuple, void *const *const elements, size_t size );
+
+/** !
+ *  Construct a tuple equal to another, except for one element. If index is negative,
+ *  index = size - |index|. Tuples narrower than 2048 elements are copied. Wider ones become
+ *  persistent: a tree of 32 element nodes, where each update copies one path in O(log n)
+ *  and shares every other node with the original. The first update of a wide flat tuple
+ *  builds its tree, in O(n). Persistent tuples are flattened, once, by calls that need
+ *  contiguous elements, like tuple_data and tuple_hash
+ *
+ * @param p_tuple   the original tuple, which is not changed
+ * @param index     signed index of the element to change
+ * @param value     the element's new value
+ * @param pp_result return
+ *
+ * @sa tuple_index
+ * @sa tuple_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_with ( const tuple *const p_tuple, signed long long index, void *const value, tuple **const pp_result );
+
+/** !
+ *  Construct a tuple from the elements of count tuples, one after the other. The result is
+ *  sized up front and allocated once, and each tuple's elements are copied straight into it
+ *
+ * @param pp_tuples the tuples
+ * @param count     quantity of tuples
+ * @param pp_result return
+ *
+ * @sa tuple_zip
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_concat ( const tuple *const *const pp_tuples, size_t count, tuple **const pp_result );
+
+/** !
+ *  Construct a tuple from the elements of another at count positions, in the order given.
+ *  Negative indices count back from the end, like tuple_index. The indices are checked as a
+ *  batch, and the elements are gathered straight into the result, like tuple_index_many
+ *
+ * @param p_tuple   the source tuple
+ * @param indices   count signed indices
+ * @param count     quantity of indices, and size of the result
+ * @param pp_result return
+ *
+ * @sa tuple_index_many
+ * @sa tuple_project_batch
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_project ( const tuple *const p_tuple, const signed long long *const indices, size_t count, tuple **const pp_result );
+
+/** !
+ *  Project each of tuple_count tuples with the same indices, like tuple_project. The results
+ *  share one block, like tuple_from_elements_batch, and are freed with tuple_destroy_batch
+ *
+ * @param pp_tuples   the source tuples
+ * @param tuple_count quantity of source tuples
+ * @param indices     count signed indices
+ * @param count       quantity of indices, and size of each result
+ * @param ppp_results return an array of tuple_count tuples
+ *
+ * @sa tuple_project
+ * @sa tuple_destroy_batch
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_project_batch ( const tuple *const *const pp_tuples, size_t tuple_count, const signed long long *const indices, size_t count, tuple ***const ppp_results );
+
+/** !
+ *  Construct a tuple that interleaves the elements of count tuples, such that
+ *  zip([A,B,C], [1,2,3]) -> [A,1,B,2,C,3]. The shortest tuple decides the quantity of rows.
+ *  The result is one flat tuple, allocated once, rather than a tuple of pairs
+ *
+ * @param pp_tuples the tuples
+ * @param count     quantity of tuples
+ * @param pp_result return
+ *
+ * @sa tuple_concat
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_zip ( const tuple *const *const pp_tuples, size_t count, tuple **const pp_result );
+
+/** !
+ *  Construct a tuple from parameters in caller provided storage. The tuple is valid for as
+ *  long as the storage is. Calling tuple_destroy on it only clears the caller's pointer
+ *
+ * @param pp_tuple      return
+ * @param p_storage     storage for the tuple
+ * @param element_count the quantity of variadic arguments, at most TUPLE_INLINE_CAPACITY
+ * @param ...           variadic elements
+ *
+ * @sa tuple_from_arguments
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_init_inline ( tuple **const pp_tuple, tuple_inline *const p_storage, size_t element_count, ... );
+
 // Accessors
 /** !
  * Index a tuple with a signed number. If index is negative, index = size - |index|, such that
@@ -126,12 +541,28 @@ DLLEXPORT int tuple_from_arguments ( tuple **const pp_tuple, size_t element_coun
 DLLEXPORT int tuple_index ( const tuple *const p_tuple, signed long long index, void **const pp_value );
 
 /** !
- * Get a slice of the tuple specified by a lower bound and an upper bound
+ * Index a tuple at many positions at once. The indices are checked as a batch, then the
+ * elements are gathered, with AVX2 gathers where the target has them. Negative indices count
+ * back from the end, like tuple_index. pp_values may be overwritten even on error
  * 
  * @param p_tuple tuple
- * @param pp_elements return
- * @param lower_bound the lower bound of the tuple
- * @param upper_bound the upper bound of the tuple
+ * @param indices count signed indices
+ * @param count quantity of indices
+ * @param pp_values return count elements, in the order of the indices
+ * 
+ * @sa tuple_index
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_index_many ( const tuple *const p_tuple, const signed long long *const indices, size_t count, void **const pp_values );
+
+/** !
+ * Get a slice of the tuple specified by a lower bound and an upper bound, inclusive
+ * 
+ * @param p_tuple tuple
+ * @param pp_elements return, with room for upper_bound - lower_bound + 1 elements
+ * @param lower_bound index of the first element in the slice
+ * @param upper_bound index of the last element in the slice, from lower_bound to tuple_size(p_tuple) - 1
  * 
  * @sa tuple_index
  * @sa tuple_get
@@ -140,6 +571,18 @@ DLLEXPORT int tuple_index ( const tuple *const p_tuple, signed long long index,
 */
 DLLEXPORT int tuple_slice ( const tuple *const p_tuple, const void **const pp_elements, signed long long lower_bound, signed long long upper_bound );
 
+/** !
+ * Get read only access to the contiguous elements of a tuple, without copying
+ * 
+ * @param p_tuple tuple
+ * 
+ * @sa tuple_slice
+ * @sa tuple_view_of
+ * 
+ * @return pointer to the first of tuple_size(p_tuple) elements on success, null pointer on error
+ */
+DLLEXPORT const void *const *tuple_data ( const tuple *const p_tuple );
+
 /** !
  *  Is a tuple empty?
  * 
@@ -158,28 +601,888 @@ DLLEXPORT bool tuple_is_empty ( const tuple *const p_tuple );
  */
 DLLEXPORT size_t tuple_size ( const tuple *const p_tuple );
 
+// Views
+/** !
+ * Make a view of every element in a tuple
+ * 
+ * @param p_tuple tuple
+ * @param p_view  return
+ * 
+ * @sa tuple_view_slice
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_view_of ( const tuple *const p_tuple, tuple_view *const p_view );
+
+/** !
+ * Make a view of part of another view. Bounds are inclusive, like tuple_slice. Negative bounds
+ * count back from the end of the view, like tuple_index
+ * 
+ * @param p_view      the view
+ * @param p_slice     return
+ * @param lower_bound index of the first element in the slice
+ * @param upper_bound index of the last element in the slice
+ * 
+ * @sa tuple_view_of
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_view_slice ( const tuple_view *const p_view, tuple_view *const p_slice, signed long long lower_bound, signed long long upper_bound );
+
+/** !
+ * Index a view with a signed number. If index is negative, index = size - |index|
+ * 
+ * @param p_view   the view
+ * @param index    signed index
+ * @param pp_value return
+ * 
+ * @sa tuple_index
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_view_index ( const tuple_view *const p_view, signed long long index, void **const pp_value );
+
+/** !
+ * Get read only access to the contiguous elements of a view, without copying
+ * 
+ * @param p_view the view
+ * 
+ * @sa tuple_data
+ * 
+ * @return pointer to the first of p_view->length elements on success, null pointer on error
+ */
+DLLEXPORT const void *const *tuple_view_data ( const tuple_view *const p_view );
+
+/** !
+ * Call function on every element in a view. The index passed to the function is relative to the view
+ * 
+ * @param p_view       the view
+ * @param pfn_function pointer to function of type void (*)(void *value, size_t index)
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_view_foreach ( const tuple_view *const p_view, void (*const pfn_function)(void *const value, size_t index) );
+
 // Iterators
 /** !
  * Call function on every element in p_tuple
  *
  * @param p_tuple tuple
- * @param function pointer to function of type void (*)(void *value, size_t index)
+ * @param pfn_function pointer to function of type void (*)(void *value, size_t index)
+ * 
+ * @sa tuple_foreach_parallel
  * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int tuple_foreach_i ( const tuple *const p_tuple, void (*const function)(void *const value, size_t index) );
+DLLEXPORT int tuple_foreach ( const tuple *const p_tuple, void (*const pfn_function)(void *const value, size_t index) );
 
-// Destructors
 /** !
- *  Destroy and deallocate a tuple
- *
- * @param pp_tuple tuple
+ * Call function on every element in p_tuple, from the calling thread and a persistent pool
+ * of worker threads. The index range is split into chunks of grain elements, and a thread
+ * that runs out of chunks steals half of another thread's remaining range. Elements are
+ * visited in no particular order, so the function must be safe to call concurrently
  *
- * @sa tuple_create
+ * @param p_tuple tuple
+ * @param pfn_function pointer to function of type void (*)(void *value, size_t index)
+ * @param grain elements claimed at once, or 0 to let the library choose
+ * 
+ * @sa tuple_foreach
+ * @sa tuple_reduce_parallel
+ * @sa tuple_parallel_threads
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_foreach_parallel ( const tuple *const p_tuple, void (*const pfn_function)(void *const value, size_t index), size_t grain );
+
+/** !
+ * Map every element in p_tuple, and combine the results, in parallel. Each thread folds
+ * the elements it visits into a partial result, starting from p_identity, and the partials
+ * are folded together on the calling thread. pfn_reduce must be associative and commutative
  *
+ * @param p_tuple tuple
+ * @param pfn_map pointer to function of type void *(*)(void *value, size_t index)
+ * @param pfn_reduce pointer to function of type void *(*)(void *left, void *right)
+ * @param p_identity the value a reduction of no elements yields
+ * @param grain elements claimed at once, or 0 to let the library choose
+ * @param pp_result return
+ * 
+ * @sa tuple_foreach_parallel
+ * 
  * @return 1 on success, 0 on error
  */
-DLLEXPORT int tuple_destroy ( tuple **const pp_tuple );
+DLLEXPORT int tuple_reduce_parallel ( const tuple *const p_tuple, void *(*const pfn_map)(void *const value, size_t index), void *(*const pfn_reduce)(void *const left, void *const right), void *const p_identity, size_t grain, void **const pp_result );
+
+/** !
+ * Set the quantity of threads used by parallel iterators, counting the calling thread. The
+ * pool is restarted on the next parallel call. The default, 0, uses one thread for each
+ * processor
+ *
+ * @param count quantity of threads, or 0 for one per processor
+ * 
+ * @sa tuple_foreach_parallel
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_parallel_threads ( size_t count );
+
+// Hashing
+/** !
+ * Hash a tuple. With no callback, the element pointers themselves are hashed, and the hash
+ * is computed once and cached in a slot after the elements, so later calls are O(1). Inline,
+ * batch, joined and built tuples have no slot, and are hashed on every call, as are tuples
+ * updated in place by tuple_set, tuple_exchange or tuple_compare_exchange. With a callback,
+ * each element's contents are hashed by the callback, and the results are combined in order.
+ * Content hashes are not cached, since they depend on the callback
+ *
+ * @param p_tuple tuple
+ * @param pfn_element_hash pointer to function of type unsigned long long (*)(const void *value), or null to hash the pointers
+ * @param p_hash return
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_hash ( const tuple *const p_tuple, unsigned long long (*const pfn_element_hash)(const void *const value), unsigned long long *const p_hash );
+
+// Comparison
+/** !
+ * Test two tuples for equality. With no callback, elements are compared by address, with
+ * an early exit when the sizes or cached hashes differ, then a single memcmp over the
+ * element arrays. With a callback, elements are compared by content
+ *
+ * @param p_a a tuple
+ * @param p_b a tuple
+ * @param pfn_compare pointer to function of type int (*)(const void *a, const void *b), or null to compare addresses
+ * 
+ * @sa tuple_compare
+ * @sa tuple_view_equals
+ * 
+ * @return true if the tuples hold equal elements in the same order, else false
+ */
+DLLEXPORT bool tuple_equals ( const tuple *const p_a, const tuple *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) );
+
+/** !
+ * Order two tuples lexicographically. The first differing element decides, and a tuple that
+ * is a prefix of the other orders first. With no callback, elements are ordered by address,
+ * which gives a consistent order for sorting and deduplication. With a callback, elements
+ * are ordered by content, and the callback returns negative, zero or positive like strcmp
+ *
+ * @param p_a a tuple
+ * @param p_b a tuple
+ * @param pfn_compare pointer to function of type int (*)(const void *a, const void *b), or null to order by address
+ * 
+ * @sa tuple_equals
+ * @sa tuple_view_compare
+ * 
+ * @return negative if p_a orders first, 0 if the tuples are equal or on error, positive if p_b orders first
+ */
+DLLEXPORT int tuple_compare ( const tuple *const p_a, const tuple *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) );
+
+/** !
+ * Test two views for equality, like tuple_equals
+ *
+ * @param p_a a view
+ * @param p_b a view
+ * @param pfn_compare pointer to function of type int (*)(const void *a, const void *b), or null to compare addresses
+ * 
+ * @sa tuple_equals
+ * 
+ * @return true if the views hold equal elements in the same order, else false
+ */
+DLLEXPORT bool tuple_view_equals ( const tuple_view *const p_a, const tuple_view *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) );
+
+/** !
+ * Order two views lexicographically, like tuple_compare
+ *
+ * @param p_a a view
+ * @param p_b a view
+ * @param pfn_compare pointer to function of type int (*)(const void *a, const void *b), or null to order by address
+ * 
+ * @sa tuple_compare
+ * 
+ * @return negative if p_a orders first, 0 if the views are equal or on error, positive if p_b orders first
+ */
+DLLEXPORT int tuple_view_compare ( const tuple_view *const p_a, const tuple_view *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) );
+
+// Searching
+/** !
+ * Find the first element with an address. Elements are compared 8 at a time with vector
+ * compares, where the target has them
+ *
+ * @param p_tuple the tuple
+ * @param value the address
+ * @param p_index return the index of the element
+ *
+ * @sa tuple_find_last
+ * @sa tuple_find_if
+ *
+ * @return true if the tuple holds the address, false if it does not, or on error
+ */
+DLLEXPORT bool tuple_find ( const tuple *const p_tuple, const void *const value, size_t *const p_index );
+
+/** !
+ * Find the last element with an address
+ *
+ * @param p_tuple the tuple
+ * @param value the address
+ * @param p_index return the index of the element
+ *
+ * @sa tuple_find
+ *
+ * @return true if the tuple holds the address, false if it does not, or on error
+ */
+DLLEXPORT bool tuple_find_last ( const tuple *const p_tuple, const void *const value, size_t *const p_index );
+
+/** !
+ * Test a tuple for an address
+ *
+ * @param p_tuple the tuple
+ * @param value the address
+ *
+ * @sa tuple_find
+ *
+ * @return true if the tuple holds the address, false if it does not, or on error
+ */
+DLLEXPORT bool tuple_contains ( const tuple *const p_tuple, const void *const value );
+
+/** !
+ * Count the elements with an address
+ *
+ * @param p_tuple the tuple
+ * @param value the address
+ *
+ * @sa tuple_find
+ *
+ * @return quantity of matching elements, or 0 on error
+ */
+DLLEXPORT size_t tuple_count ( const tuple *const p_tuple, const void *const value );
+
+/** !
+ * Find the first element a predicate accepts. The predicate is called in order, and not
+ * again once it returns true
+ *
+ * @param p_tuple the tuple
+ * @param pfn_predicate pointer to function of type bool (*)(void *value, size_t index)
+ * @param p_index return the index of the element
+ *
+ * @sa tuple_find
+ *
+ * @return true if an element was accepted, false if none were, or on error
+ */
+DLLEXPORT bool tuple_find_if ( const tuple *const p_tuple, bool (*const pfn_predicate)(void *const value, size_t index), size_t *const p_index );
+
+// Sorting
+/** !
+ * Sort an array of tuples by one or more keys, most significant first. The sort is stable,
+ * so tuples with equal keys keep their order. The keys are copied into one contiguous buffer
+ * up front, and sorted there. When every key orders by address, the buffer is radix sorted,
+ * skipping bytes no key differs in. Otherwise it is merge sorted. Both run on the calling
+ * thread and the worker pool, so comparators must be safe to call concurrently
+ *
+ * @param pp_tuples the tuples, sorted in place
+ * @param count quantity of tuples
+ * @param p_keys the keys
+ * @param key_count quantity of keys, at most 16
+ *
+ * @sa tuple_compare
+ * @sa tuple_parallel_threads
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_array_sort ( tuple **const pp_tuples, size_t count, const tuple_sort_key *const p_keys, size_t key_count );
+
+// Joining
+/** !
+ * Join two collections of tuples on the elements at matching key positions, which match when
+ * their addresses are equal. Each result is a left tuple's elements followed by a right
+ * tuple's elements. In a left join, a left tuple that matched nothing is followed by as many
+ * null pointers as the first right tuple has elements. Both sides are radix partitioned on a
+ * hash of their keys, and each partition builds a cache sized hash table of its right tuples,
+ * then probes it with its left tuples, so pass the smaller collection on the right. Every
+ * result lives in one block, like tuple_from_elements_batch, and results are grouped by
+ * partition, not in input order
+ *
+ * @param pp_left the left tuples, which probe
+ * @param left_count quantity of left tuples
+ * @param pp_right the right tuples, which build
+ * @param right_count quantity of right tuples
+ * @param left_keys key positions in each left tuple
+ * @param right_keys key positions in each right tuple
+ * @param key_count quantity of key positions on each side
+ * @param mode TUPLE_JOIN_INNER or TUPLE_JOIN_LEFT
+ * @param parallel true to hash and join partitions on the worker pool
+ * @param ppp_results return the results
+ * @param p_count return the quantity of results
+ *
+ * @sa tuple_concat
+ * @sa tuple_destroy_batch
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_join ( const tuple *const *const pp_left, size_t left_count, const tuple *const *const pp_right, size_t right_count, const signed long long *const left_keys, const signed long long *const right_keys, size_t key_count, tuple_join_mode mode, bool parallel, tuple ***const ppp_results, size_t *const p_count );
+
+// Pools
+/** !
+ *  Attach a pool to the calling thread. While a pool is attached, every tuple the thread
+ *  constructs is drawn from the pool, and every pool tuple the thread destroys is kept on
+ *  a thread local free list. Cached blocks are returned to the previous pool, if any, and to
+ *  the attached pool when the thread exits
+ *
+ * @param p_pool the pool, or null to detach
+ *
+ * @sa tuple_pool_create
+ * @sa tuple_pool_reset
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pool_attach ( tuple_pool *const p_pool );
+
+/** !
+ *  Release every slab of a pool. Every tuple drawn from the pool becomes invalid. The
+ *  caller must make sure no other thread is using the pool's tuples during the reset
+ *
+ * @param p_pool the pool
+ *
+ * @sa tuple_pool_attach
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pool_reset ( tuple_pool *const p_pool );
+
+// Arenas
+/** !
+ *  Attach an arena to the calling thread. While an arena is attached, every tuple the thread
+ *  constructs is bump allocated from the arena, even if a pool is also attached. Calling
+ *  tuple_destroy on an arena tuple only clears the caller's pointer. An arena must not be
+ *  attached to more than one thread at a time
+ *
+ * @param p_arena the arena, or null to detach
+ *
+ * @sa tuple_arena_create
+ * @sa tuple_arena_reset
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_arena_attach ( tuple_arena *const p_arena );
+
+/** !
+ *  Release every tuple allocated from an arena in constant time. The arena keeps its chunks,
+ *  and reuses them for the tuples that follow
+ *
+ * @param p_arena the arena
+ *
+ * @sa tuple_arena_attach
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_arena_reset ( tuple_arena *const p_arena );
+
+// Interning
+/** !
+ *  Get the canonical tuple for a sequence of elements, constructing it on first use. Every
+ *  call with equal elements returns the same tuple, so interned tuples can be compared by
+ *  pointer. The caller gets a reference, and gives it up with tuple_release. The table keeps
+ *  its own reference. Canonical tuples come from the calling thread's pool, or the heap,
+ *  never from an arena. Safe to call from many threads; the table is split into 64
+ *  independently locked, open addressed stripes
+ *
+ * @param p_table the intern table
+ * @param elements pointer to array of elements
+ * @param size quantity of elements
+ * @param pp_tuple return
+ *
+ * @sa tuple_intern_collect
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_intern ( tuple_intern_table *const p_table, void *const *const elements, size_t size, tuple **const pp_tuple );
+
+/** !
+ *  Drop every canonical tuple that only the table still references
+ *
+ * @param p_table the intern table
+ *
+ * @sa tuple_intern
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_intern_collect ( tuple_intern_table *const p_table );
+
+// Tables
+/** !
+ *  Append a row to a table. Each element is written to the end of its column. Appending
+ *  may move the columns, so pointers from tuple_table_column do not survive it
+ *
+ * @param p_table the table
+ * @param elements pointer to array of arity elements
+ * @param p_row return the new row's index, or null
+ *
+ * @sa tuple_table_append_tuple
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_table_append ( tuple_table *const p_table, void *const *const elements, size_t *const p_row );
+
+/** !
+ *  Append a copy of a tuple's elements to a table as a row. The tuple's size must match
+ *  the table's arity
+ *
+ * @param p_table the table
+ * @param p_tuple the tuple
+ * @param p_row return the new row's index, or null
+ *
+ * @sa tuple_table_append
+ * @sa tuple_row_to_tuple
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_table_append_tuple ( tuple_table *const p_table, const tuple *const p_tuple, size_t *const p_row );
+
+/** !
+ *  Get a handle to a row. If row is negative, row = rows - |row|
+ *
+ * @param p_table the table
+ * @param row signed row index
+ * @param p_row return
+ *
+ * @sa tuple_row_index
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_table_row ( const tuple_table *const p_table, signed long long row, tuple_row *const p_row );
+
+/** !
+ *  Get a column of a table, as a contiguous array with one element per row. Scanning a
+ *  column touches only that column's memory
+ *
+ * @param p_table the table
+ * @param column index of the column, less than the table's arity
+ *
+ * @sa tuple_table_size
+ *
+ * @return pointer to the column on success, null pointer on error
+ */
+DLLEXPORT void *const *tuple_table_column ( const tuple_table *const p_table, size_t column );
+
+/** !
+ *  Get the quantity of rows in a table
+ *
+ * @param p_table the table
+ *
+ * @return quantity of rows
+ */
+DLLEXPORT size_t tuple_table_size ( const tuple_table *const p_table );
+
+/** !
+ *  Get the arity of a table's rows
+ *
+ * @param p_table the table
+ *
+ * @return quantity of elements in each row
+ */
+DLLEXPORT size_t tuple_table_arity ( const tuple_table *const p_table );
+
+/** !
+ *  Index a row with a signed number, like tuple_index
+ *
+ * @param p_row the row
+ * @param index signed index
+ * @param pp_value return
+ *
+ * @sa tuple_index
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_row_index ( const tuple_row *const p_row, signed long long index, void **const pp_value );
+
+/** !
+ *  Copy the elements from lower_bound to upper_bound, inclusive, of a row, like tuple_slice
+ *
+ * @param p_row the row
+ * @param pp_elements return
+ * @param lower_bound the lower bound of the row
+ * @param upper_bound the upper bound of the row
+ *
+ * @sa tuple_slice
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_row_slice ( const tuple_row *const p_row, const void **const pp_elements, signed long long lower_bound, signed long long upper_bound );
+
+/** !
+ *  Construct an ordinary tuple from a row
+ *
+ * @param p_row the row
+ * @param pp_tuple return
+ *
+ * @sa tuple_table_append_tuple
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_row_to_tuple ( const tuple_row *const p_row, tuple **const pp_tuple );
+
+// Builders
+/** !
+ *  Append an element to a builder. Null is a valid element. The buffer doubles when it is
+ *  full, so appending is amortized constant time
+ *
+ * @param p_builder the builder
+ * @param value the element
+ *
+ * @sa tuple_builder_push_n
+ * @sa tuple_builder_freeze
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_builder_push ( tuple_builder *const p_builder, void *const value );
+
+/** !
+ *  Append count elements to a builder
+ *
+ * @param p_builder the builder
+ * @param elements pointer to array of count elements
+ * @param count quantity of elements
+ *
+ * @sa tuple_builder_push
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_builder_push_n ( tuple_builder *const p_builder, void *const *const elements, size_t count );
+
+/** !
+ *  Get the quantity of elements pushed to a builder since it was created or last frozen
+ *
+ * @param p_builder the builder
+ *
+ * @return the quantity of elements on success, 0 on error
+ */
+DLLEXPORT size_t tuple_builder_size ( const tuple_builder *const p_builder );
+
+/** !
+ *  Turn a builder's buffer into a tuple, without copying the elements. The tuple is a heap
+ *  tuple, even when a pool or an arena is attached, and is freed with tuple_destroy. The
+ *  builder is left empty, and may be reused
+ *
+ * @param p_builder the builder
+ * @param pp_tuple return
+ *
+ * @sa tuple_builder_push
+ * @sa tuple_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_builder_freeze ( tuple_builder *const p_builder, tuple **const pp_tuple );
+
+// Pipelines
+/** !
+ *  Add a map stage to a pipeline. Nothing runs until the pipeline is collected or reduced
+ *
+ * @param p_pipeline the pipeline
+ * @param pfn_map pointer to function of type void *(*)(void *value, size_t index), where index is the element's index in the source
+ *
+ * @sa tuple_pipeline_filter
+ * @sa tuple_pipeline_collect
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pipeline_map ( tuple_pipeline *const p_pipeline, void *(*const pfn_map)(void *const value, size_t index) );
+
+/** !
+ *  Add a filter stage to a pipeline. Elements the predicate rejects skip every later stage
+ *
+ * @param p_pipeline the pipeline
+ * @param pfn_predicate pointer to function of type bool (*)(void *value, size_t index), where index is the element's index in the source
+ *
+ * @sa tuple_pipeline_map
+ * @sa tuple_pipeline_collect
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pipeline_filter ( tuple_pipeline *const p_pipeline, bool (*const pfn_predicate)(void *const value, size_t index) );
+
+/** !
+ *  Run a pipeline, in one pass over the source, writing each element that makes it through
+ *  every stage straight into one new tuple. No tuples are made between stages. A pipeline
+ *  can be run any number of times
+ *
+ * @param p_pipeline the pipeline
+ * @param pp_result return
+ *
+ * @sa tuple_pipeline_reduce
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pipeline_collect ( const tuple_pipeline *const p_pipeline, tuple **const pp_result );
+
+/** !
+ *  Run a pipeline, in one pass over the source, folding each element that makes it through
+ *  every stage into an accumulator, in order
+ *
+ * @param p_pipeline the pipeline
+ * @param pfn_reduce pointer to function of type void *(*)(void *left, void *right), called with the accumulator and an element
+ * @param p_identity the accumulator's initial value, and the result when no element is kept
+ * @param pp_result return
+ *
+ * @sa tuple_pipeline_collect
+ * @sa tuple_reduce_parallel
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pipeline_reduce ( const tuple_pipeline *const p_pipeline, void *(*const pfn_reduce)(void *const left, void *const right), void *const p_identity, void **const pp_result );
+
+// Atomic updates
+/** !
+ *  Store an element in place, as an atomic store. Tuples updated this way are fixed size slot
+ *  arrays. Read them concurrently with tuple_index_acquire, not tuple_index. A tuple that is
+ *  being updated must not be in an intern table, and must not be hashed until the writers
+ *  are done. Its identity hash is no longer cached, so tuple_hash recomputes it
+ *
+ * @param p_tuple the tuple
+ * @param index signed index of the slot. If index is negative, index = size - |index|
+ * @param value the new element
+ * @param order memory_order_relaxed, memory_order_release, or memory_order_seq_cst
+ *
+ * @sa tuple_exchange
+ * @sa tuple_index_acquire
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_set ( tuple *const p_tuple, signed long long index, void *const value, memory_order order );
+
+/** !
+ *  Store an element in place, and get the element it replaced, as one atomic operation
+ *
+ * @param p_tuple the tuple
+ * @param index signed index of the slot
+ * @param value the new element
+ * @param pp_old return the old element, or null
+ * @param order any memory order
+ *
+ * @sa tuple_set
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_exchange ( tuple *const p_tuple, signed long long index, void *const value, void **const pp_old, memory_order order );
+
+/** !
+ *  Store an element in place if the slot still holds the expected element. Otherwise, the
+ *  element it does hold is written to the expected element
+ *
+ * @param p_tuple the tuple
+ * @param index signed index of the slot
+ * @param pp_expected the expected element, and return the current element on failure
+ * @param desired the new element
+ * @param success memory order when the element is stored
+ * @param failure memory order when it is not. Not release or acq_rel
+ *
+ * @sa tuple_exchange
+ *
+ * @return true if the element was stored, false if it was not, or on error
+ */
+DLLEXPORT bool tuple_compare_exchange ( tuple *const p_tuple, signed long long index, void **const pp_expected, void *const desired, memory_order success, memory_order failure );
+
+/** !
+ *  Index a tuple with an acquire load, so that whatever the writer published before a release
+ *  store of the element is visible to the caller
+ *
+ * @param p_tuple the tuple
+ * @param index signed index
+ * @param pp_value return
+ *
+ * @sa tuple_set
+ * @sa tuple_index
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_index_acquire ( const tuple *const p_tuple, signed long long index, void **const pp_value );
+
+// Reference counting
+/** !
+ *  Add a reference to a tuple, so it can be shared with another thread without copying.
+ *  Every tuple starts with one reference, owned by whoever constructed it. Each reference
+ *  is given up with tuple_release or tuple_destroy
+ *
+ * @param p_tuple tuple
+ *
+ * @sa tuple_release
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_retain ( tuple *const p_tuple );
+
+// Deferred reclamation
+/** !
+ *  Enter a read section on the calling thread. Tuples passed to tuple_destroy_deferred by
+ *  any thread after this call are not freed until this thread calls tuple_read_exit. Read
+ *  sections nest, and take no locks
+ *
+ * @param void
+ *
+ * @sa tuple_read_exit
+ * @sa tuple_destroy_deferred
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_read_enter ( void );
+
+/** !
+ *  Leave a read section on the calling thread
+ *
+ * @param void
+ *
+ * @sa tuple_read_enter
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_read_exit ( void );
+
+/** !
+ *  Destroy a tuple once every thread that might still be reading it has left its read
+ *  section. Tuples are kept in per thread batches, labelled with the global epoch, and
+ *  released in bulk once every reader has moved two epochs past them
+ *
+ * @param pp_tuple tuple
+ *
+ * @sa tuple_read_enter
+ * @sa tuple_reclaim
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_destroy_deferred ( tuple **const pp_tuple );
+
+/** !
+ *  Try to advance the global epoch, and release the calling thread's deferred tuples that
+ *  no reader can still see, along with those left behind by threads that exited. Useful
+ *  when a thread stops deferring and wants its batch freed
+ *
+ * @param void
+ *
+ * @sa tuple_destroy_deferred
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_reclaim ( void );
+
+// Destructors
+/** !
+ *  Give up the caller's reference to a tuple. The tuple is deallocated, to the heap or the
+ *  pool it came from, when the last reference is given up
+ *
+ * @param pp_tuple tuple
+ *
+ * @sa tuple_retain
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_release ( tuple **const pp_tuple );
+
+/** !
+ *  Destroy and deallocate a tuple. Same as tuple_release, so a tuple that was retained
+ *  lives on until its last reference is released
+ *
+ * @param pp_tuple tuple
+ *
+ * @sa tuple_create
+ * @sa tuple_release
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_destroy ( tuple **const pp_tuple );
+
+/** !
+ *  Free every tuple constructed by one call to tuple_from_elements_batch
+ *
+ * @param ppp_tuples pointer to the array of tuple pointers
+ *
+ * @sa tuple_from_elements_batch
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_destroy_batch ( tuple ***const ppp_tuples );
+
+/** !
+ *  Give up the caller's reference to a tuple, and take its elements as an array allocated
+ *  with TUPLE_REALLOC. An adopted array is handed over in constant time when the caller
+ *  holds the only reference. Otherwise the elements are copied. An empty tuple detaches
+ *  as a null array
+ *
+ * @param pp_tuple tuple
+ * @param ppp_elements return the element array, which the caller frees
+ * @param p_size return the quantity of elements, or null
+ *
+ * @sa tuple_adopt
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_detach ( tuple **const pp_tuple, void ***const ppp_elements, size_t *const p_size );
+
+/** !
+ *  Destroy a pool and every tuple drawn from it. The calling thread is detached. Other
+ *  threads must detach before the pool is destroyed
+ *
+ * @param pp_pool pool
+ *
+ * @sa tuple_pool_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pool_destroy ( tuple_pool **const pp_pool );
+
+/** !
+ *  Destroy an arena, every tuple allocated from it, and every chunk it kept. The calling
+ *  thread is detached
+ *
+ * @param pp_arena arena
+ *
+ * @sa tuple_arena_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_arena_destroy ( tuple_arena **const pp_arena );
+
+/** !
+ *  Destroy an intern table, and give up its reference to each canonical tuple. Tuples that
+ *  callers still hold stay valid
+ *
+ * @param pp_table intern table
+ *
+ * @sa tuple_intern_table_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_intern_table_destroy ( tuple_intern_table **const pp_table );
+
+/** !
+ *  Destroy a columnar table. Tuples built from its rows stay valid
+ *
+ * @param pp_table table
+ *
+ * @sa tuple_table_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_table_destroy ( tuple_table **const pp_table );
+
+/** !
+ *  Destroy a builder, and any elements pushed since it was last frozen. Tuples it froze stay
+ *  valid
+ *
+ * @param pp_builder builder
+ *
+ * @sa tuple_builder_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_builder_destroy ( tuple_builder **const pp_builder );
+
+/** !
+ *  Release a pipeline, and its reference to the source tuple
+ *
+ * @param pp_pipeline pointer to pipeline pointer
+ *
+ * @sa tuple_pipeline_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int tuple_pipeline_destroy ( tuple_pipeline **const pp_pipeline );
 
 // Cleanup
 /** !
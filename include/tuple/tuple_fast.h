@@ -0,0 +1,271 @@
+/** !
+ * @file tuple/tuple_fast.h 
+ * 
+ * @author Jacob Smith
+ * 
+ * Inline fast path accessors for the tuple library. Including this header makes the layout
+ * of struct tuple_s part of the caller's build, so it must match the library it links against
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <assert.h>
+#include <stdatomic.h>
+
+// tuple
+#include <tuple/tuple.h>
+
+// Branch hints
+#if defined(__GNUC__) || defined(__clang__)
+    #define TUPLE_LIKELY(x)   __builtin_expect(!!(x), 1)
+    #define TUPLE_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+    #define TUPLE_LIKELY(x)   (x)
+    #define TUPLE_UNLIKELY(x) (x)
+#endif
+
+// Argument errors. Release builds assert instead of reporting, and the assert compiles out with NDEBUG
+#ifdef TUPLE_RELEASE
+    #define TUPLE_FAST_ERROR(status, message) assert(!message)
+#else
+    #define TUPLE_FAST_ERROR(status, message) tuple_report(status, message " in call to function \"%s\"\n", __FUNCTION__)
+#endif
+
+// Expected failures, like an index out of bounds, are always reported
+#define TUPLE_FAST_FAIL(status, message) tuple_report(status, message " in call to function \"%s\"\n", __FUNCTION__)
+
+// Enumeration definitions
+enum tuple_flag_e
+{
+    TUPLE_FLAG_POOL     = 1 << 0, // The tuple was drawn from a tuple_pool
+    TUPLE_FLAG_ARENA    = 1 << 1, // The tuple was drawn from a tuple_arena
+    TUPLE_FLAG_INLINE   = 1 << 2, // The tuple lives in caller provided storage
+    TUPLE_FLAG_BATCH    = 1 << 3, // The tuple lives in a block shared with a batch of tuples
+    TUPLE_FLAG_OWNER    = 1 << 4, // The tuple owns an element array outside its block
+    TUPLE_FLAG_TREE     = 1 << 5, // The tuple's elements are in a tree of shared nodes
+    TUPLE_FLAG_BORROWED = 1 << 6, // The tuple reads a caller's array, and never writes to it
+    TUPLE_FLAG_HASH     = 1 << 7  // The tuple has a slot for its cached identity hash
+};
+
+// Tuples whose elements are not stored after the header. Adopted and borrowed tuples keep a
+// pointer to their array in _elements[0], and persistent tuples keep a tree in place of elements
+#define TUPLE_FLAGS_EXTERNAL ( TUPLE_FLAG_OWNER | TUPLE_FLAG_BORROWED )
+#define TUPLE_FLAGS_INDIRECT ( TUPLE_FLAGS_EXTERNAL | TUPLE_FLAG_TREE )
+
+// Structure definitions
+struct tuple_s
+{
+    size_t        element_count; // Quantity of elements
+    unsigned int _flags;         // Storage flags
+    atomic_uint  _references;    // Reference count
+    void        *_elements[];    // Contents stored after the header, or what the storage flags put there
+};
+
+// Accessors
+/** !
+ *  Get the size of a tuple
+ * 
+ * @param p_tuple a tuple
+ * 
+ * @sa tuple_size
+ * 
+ * @return size of tuple
+ */
+static inline size_t tuple_size_fast ( const tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( TUPLE_UNLIKELY(p_tuple == (void *) 0) ) goto no_tuple;
+
+    // Success
+    return p_tuple->element_count;
+
+    // Error handling
+    no_tuple:
+        TUPLE_FAST_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\"");
+
+        // Error
+        return 0;
+}
+
+/** !
+ *  Is a tuple empty?
+ * 
+ * @param p_tuple a tuple
+ * 
+ * @sa tuple_is_empty
+ * 
+ * @return true if tuple has no contents else false
+ */
+static inline bool tuple_is_empty_fast ( const tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( TUPLE_UNLIKELY(p_tuple == (void *) 0) ) goto no_tuple;
+
+    // Success
+    return ( p_tuple->element_count == 0 );
+
+    // Error handling
+    no_tuple:
+        TUPLE_FAST_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\"");
+
+        // Error
+        return 0;
+}
+
+/** !
+ * Index a tuple with a signed number. If index is negative, index = size - |index|
+ * 
+ * @param p_tuple  tuple
+ * @param index    signed index
+ * @param pp_value return
+ * 
+ * @sa tuple_index
+ * 
+ * @return 1 on success, 0 on error 
+ */
+static inline int tuple_index_fast ( const tuple *const p_tuple, signed long long index, void **const pp_value )
+{
+
+    // Argument check
+    if ( TUPLE_UNLIKELY(p_tuple  == (void *) 0) ) goto no_tuple;
+    if ( TUPLE_UNLIKELY(pp_value == (void *) 0) ) goto no_value;
+
+    // Initialized data
+    size_t offset = ( index < 0 ) ? p_tuple->element_count + (size_t) index : (size_t) index;
+
+    // Bounds check. Negative indices past the front wrap around to huge offsets
+    if ( TUPLE_UNLIKELY(offset >= p_tuple->element_count) ) goto bounds_error;
+
+    // Adopted, borrowed and persistent tuples go through the library
+    if ( TUPLE_UNLIKELY(p_tuple->_flags & TUPLE_FLAGS_INDIRECT) ) return tuple_index(p_tuple, (signed long long) offset, pp_value);
+
+    // Return the element
+    *pp_value = p_tuple->_elements[offset];
+
+    // Success
+    return 1;
+
+    // Error handling
+    no_tuple:
+        TUPLE_FAST_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\"");
+
+        // Error
+        return 0;
+
+    no_value:
+        TUPLE_FAST_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_value\"");
+
+        // Error
+        return 0;
+
+    bounds_error:
+        TUPLE_FAST_FAIL(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds");
+
+        // Error
+        return 0;
+}
+
+/** !
+ * Get read only access to the contiguous elements of a tuple
+ * 
+ * @param p_tuple tuple
+ * 
+ * @sa tuple_data
+ * 
+ * @return pointer to the first of tuple_size(p_tuple) elements on success, null pointer on error
+ */
+static inline const void *const *tuple_data_fast ( const tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( TUPLE_UNLIKELY(p_tuple == (void *) 0) ) goto no_tuple;
+
+    // Adopted, borrowed and persistent tuples go through the library
+    if ( TUPLE_UNLIKELY(p_tuple->_flags & TUPLE_FLAGS_INDIRECT) ) return tuple_data(p_tuple);
+
+    // Success
+    return (const void *const *) p_tuple->_elements;
+
+    // Error handling
+    no_tuple:
+        TUPLE_FAST_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\"");
+
+        // Error
+        return (void *) 0;
+}
+
+// Unchecked accessors. The caller guarantees every argument is valid
+/** !
+ *  Get the size of a tuple, without validation
+ * 
+ * @param p_tuple a tuple
+ * 
+ * @return size of tuple
+ */
+static inline size_t tuple_size_unchecked ( const tuple *const p_tuple )
+{
+
+    // Success
+    return p_tuple->element_count;
+}
+
+/** !
+ *  Is a tuple empty? No validation
+ * 
+ * @param p_tuple a tuple
+ * 
+ * @return true if tuple has no contents else false
+ */
+static inline bool tuple_is_empty_unchecked ( const tuple *const p_tuple )
+{
+
+    // Success
+    return ( p_tuple->element_count == 0 );
+}
+
+/** !
+ * Index a tuple with a signed number, without validation. If index is negative,
+ * index = size - |index|. The index must be in bounds
+ * 
+ * @param p_tuple tuple
+ * @param index   signed index
+ * 
+ * @return the element
+ */
+static inline void *tuple_index_unchecked ( const tuple *const p_tuple, signed long long index )
+{
+
+    // Initialized data
+    void *p_value = (void *) 0;
+
+    // Adopted, borrowed and persistent tuples go through the library
+    if ( TUPLE_UNLIKELY(p_tuple->_flags & TUPLE_FLAGS_INDIRECT) )
+    {
+        tuple_index(p_tuple, index, &p_value);
+        return p_value;
+    }
+
+    // Success
+    return p_tuple->_elements[( index < 0 ) ? p_tuple->element_count + (size_t) index : (size_t) index];
+}
+
+/** !
+ * Get read only access to the contiguous elements of a tuple, without validation
+ * 
+ * @param p_tuple tuple
+ * 
+ * @return pointer to the first of tuple_size(p_tuple) elements
+ */
+static inline const void *const *tuple_data_unchecked ( const tuple *const p_tuple )
+{
+
+    // Adopted, borrowed and persistent tuples go through the library
+    if ( TUPLE_UNLIKELY(p_tuple->_flags & TUPLE_FLAGS_INDIRECT) ) return tuple_data(p_tuple);
+
+    // Success
+    return (const void *const *) p_tuple->_elements;
+}
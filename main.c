@@ -72,33 +72,18 @@ int print_all_elements ( tuple *p_tuple )
     if ( p_tuple == 0 ) return 0;
 
     // Initialized data
-    const void **pp_elements = 0;
-    size_t       size        = 0;
-
-    // Get quantity of elements in the tuple
-    size = tuple_size(p_tuple);
-
-    // Allocate memory for tuple contents
-    pp_elements = calloc(size, sizeof(void *));
-
-    // Error check
-    if ( pp_elements == (void *) 0 ) return 0;
-
-    // Get the contents of the tuple
-    tuple_slice(p_tuple, pp_elements, 0, (signed long long) size);
+    const void *const *pp_elements = tuple_data(p_tuple);
+    size_t             size        = tuple_size(p_tuple);
 
     // Iterate over each element
     for (size_t i = 0; i < size; i++)
 
         // Print each key
-        printf("[%lu] %s\n", i, (char *)pp_elements[i]);
+        printf("[%lu] %s\n", i, (const char *)pp_elements[i]);
     
     // Formatting
     putchar('\n');
 
-    // Clean up
-    free(pp_elements);
-    
     // Success
     return 1;
 }
\ No newline at end of file
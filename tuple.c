@@ -8,16 +8,486 @@
 
 // Headers
 #include <tuple/tuple.h>
+#include <tuple/tuple_fast.h>
+
+// Standard library
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#ifndef _WIN64
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// sync module
+#include <sync/sync.h>
+
+// Vector compares of 64 bit element addresses
+#if defined(__AVX2__) && defined(__x86_64__)
+    #include <immintrin.h>
+    #define TUPLE_SIMD_AVX2
+#elif ( defined(__SSE2__) && defined(__x86_64__) ) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define TUPLE_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define TUPLE_SIMD_NEON
+#endif
+
+// Preprocessor definitions
+#define TUPLE_POOL_EXACT_CLASSES  17    // Arity 0 through 16 each get their own size class ...
+#define TUPLE_POOL_CLASSES        29    // ... then 32, 64, ..., 65536 elements
+#define TUPLE_POOL_SLAB_SIZE      65536 // Minimum size of a slab in bytes
+#define TUPLE_POOL_SLAB_BLOCKS    4     // Minimum quantity of blocks in a slab
+#define TUPLE_POOL_CACHE_MAX      64    // Free blocks a thread may cache per size class
+#define TUPLE_POOL_BATCH          32    // Blocks moved between a thread and its pool at once
+#define TUPLE_ARENA_CHUNK_SIZE    65536 // Minimum size of an arena chunk in bytes
+#define TUPLE_LOG_MESSAGE_MAX     512   // Longest message logged by tuple_report
+#define TUPLE_EPOCH_BAGS          3     // Limbo bags per thread, one each for the current and two previous epochs
+#define TUPLE_EPOCH_BATCH         64    // Deferred tuples a thread collects in an epoch before it tries to reclaim
+#define TUPLE_WORKERS_MAX         63    // Most worker threads in the parallel pool
+#define TUPLE_PARALLEL_CHUNKS     8     // Chunks per thread when the caller leaves the grain size to the library
+#define TUPLE_INTERN_STRIPES      64    // Independently locked sub tables in an intern table
+#define TUPLE_INTERN_CAPACITY     16    // Initial slots in each stripe
+#define TUPLE_TABLE_CAPACITY      64    // Initial rows in a columnar table
+#define TUPLE_BUILDER_CAPACITY    8     // Initial elements in a builder
+#define TUPLE_PIPELINE_STAGES     4     // Initial stages in a pipeline
+#define TUPLE_PIPELINE_BLOCK      256   // Elements that go through a pipeline's stages together
+#define TUPLE_SORT_KEYS_MAX       16    // Most keys a sort can order by
+#define TUPLE_SORT_RUN            32    // Rows insertion sorted before the first merge pass
+#define TUPLE_SORT_SEGMENT        4096  // Rows each task writes during a merge pass
+#define TUPLE_SORT_BLOCK          16384 // Rows each task counts and scatters during a radix pass
+#define TUPLE_SORT_RADIX_MIN      256   // Fewer rows are merge sorted, even by address
+#define TUPLE_JOIN_BLOCK          16384 // Tuples each task hashes and scatters while partitioning a join
+#define TUPLE_JOIN_PARTITION      8192  // Right tuples in a join partition, so its hash table stays in cache
+#define TUPLE_JOIN_BITS_MAX       12    // Most hash bits a join partitions on
+#define TUPLE_NODE_BITS           5     // Index bits consumed by each level of a persistent tuple
+#define TUPLE_NODE_WIDTH          ( 1 << TUPLE_NODE_BITS ) // Slots in each node of a persistent tuple
+#define TUPLE_NODE_MASK           ( TUPLE_NODE_WIDTH - 1 )
+#define TUPLE_PERSISTENT_MIN      2048  // Narrower tuples are copied by tuple_with, wider ones become trees
+
+// Report a failure. The status is always recorded. The message is only formatted when logging
+// is on, and the logging compiles out with NDEBUG
+#ifndef NDEBUG
+    #define TUPLE_ERROR(status, ...) ( tuple_status_value = (status), TUPLE_UNLIKELY(atomic_load_explicit(&tuple_log_max, memory_order_relaxed)) ? tuple_log(__VA_ARGS__) : (void) 0 )
+#else
+    #define TUPLE_ERROR(status, ...) ( (void) ( tuple_status_value = (status) ) )
+#endif
+
+// Enumeration definitions
+// enum tuple_flag_e is defined in tuple_fast.h
 
 // Structure definitions
-struct tuple_s
+// struct tuple_s is defined in tuple_fast.h
+
+// Words reserved for the cached identity hash. The slot follows the elements of a flat tuple,
+// the array pointer of an adopted or borrowed tuple, and precedes the tree of a persistent one
+#define TUPLE_HASH_SLOTS ( ( sizeof(unsigned long long) + sizeof(void *) - 1 ) / sizeof(void *) )
+
+// Hash slot values that are not hashes. Computed hashes are moved off both, and a tuple that
+// has been updated in place is never cached again, so a hash of the elements before an update
+// cannot be published after it
+#define TUPLE_HASH_NONE    ( 0ULL )  // Not hashed yet
+#define TUPLE_HASH_UPDATED ( ~0ULL ) // Updated in place, hashed on demand from now on
+
+// Persistent tuples keep their tree after the hash slot, where flat tuples keep their elements
+#define TUPLE_TREE(p_tuple) ( (struct tuple_tree_s *) &(p_tuple)->_elements[TUPLE_HASH_SLOTS] )
+
+// Contiguous elements of a tuple that is not persistent. Adopted and borrowed tuples point at
+// their array from the first slot
+#define TUPLE_ARRAY(p_tuple) ( ( (p_tuple)->_flags & TUPLE_FLAGS_EXTERNAL ) ? (void **) (p_tuple)->_elements[0] : (void **) (p_tuple)->_elements )
+
+// Static assertions
+_Static_assert(sizeof(struct tuple_s) + ( TUPLE_INLINE_CAPACITY * sizeof(void *) ) <= TUPLE_INLINE_SIZE, "TUPLE_INLINE_CAPACITY does not fit in TUPLE_INLINE_SIZE");
+_Static_assert(sizeof(atomic_ullong) <= TUPLE_HASH_SLOTS * sizeof(void *) && _Alignof(atomic_ullong) <= _Alignof(void *), "The hash slot does not fit in TUPLE_HASH_SLOTS words");
+
+/** !
+ * Get the slot where a tuple caches its identity hash
+ * 
+ * @param p_tuple tuple
+ * 
+ * @return pointer to the slot, or null pointer if the tuple hashes on demand
+ */
+static inline atomic_ullong *tuple_hash_slot ( const tuple *const p_tuple )
+{
+
+    // Inline, batch, joined and built tuples have no slot
+    if ( ( p_tuple->_flags & TUPLE_FLAG_HASH ) == 0 ) return (void *) 0;
+
+    // Persistent tuples keep it before the tree, adopted and borrowed tuples after the array pointer
+    if ( p_tuple->_flags & TUPLE_FLAG_TREE     ) return (atomic_ullong *) &((tuple *) p_tuple)->_elements[0];
+    if ( p_tuple->_flags & TUPLE_FLAGS_EXTERNAL ) return (atomic_ullong *) &((tuple *) p_tuple)->_elements[1];
+
+    // Success
+    return (atomic_ullong *) &((tuple *) p_tuple)->_elements[p_tuple->element_count];
+}
+
+struct tuple_pool_block_s
+{
+    union
+    {
+        tuple_pool                *p_pool; // Owning pool, while the block is in use
+        struct tuple_pool_block_s *p_next; // Next free block, while the block is on a free list
+    };
+    size_t size_class;                     // Size class of the block
+};
+
+struct tuple_pool_slab_s
+{
+    struct tuple_pool_slab_s *p_next; // Next slab
+    size_t                    _size;  // Size of the slab in bytes
+};
+
+struct tuple_pool_s
+{
+    mutex                      _lock;                         // Guards the slabs and the shared free lists
+    atomic_size_t              generation;                    // Incremented each time the pool is reset
+    struct tuple_pool_slab_s  *p_slabs;                       // Every slab owned by the pool
+    struct tuple_pool_block_s *_p_free[TUPLE_POOL_CLASSES];   // Shared free lists
+    unsigned char             *_p_cursor[TUPLE_POOL_CLASSES]; // Next unused byte of each class' active slab
+    unsigned char             *_p_end[TUPLE_POOL_CLASSES];    // End of each class' active slab
+};
+
+struct tuple_pool_cache_s
+{
+    tuple_pool                *p_pool;                      // The pool attached to this thread
+    size_t                     generation;                  // Generation of the pool the lists belong to
+    struct tuple_pool_block_s *_p_free[TUPLE_POOL_CLASSES]; // Thread local free lists
+    size_t                     _count[TUPLE_POOL_CLASSES];  // Length of each free list
+};
+
+struct tuple_arena_chunk_s
+{
+    struct tuple_arena_chunk_s *p_next; // Next chunk
+    size_t                      _size;  // Size of the chunk in bytes
+};
+
+struct tuple_arena_s
+{
+    struct tuple_arena_chunk_s *p_head;   // First chunk
+    struct tuple_arena_chunk_s *p_chunk;  // Chunk being carved
+    unsigned char              *p_cursor; // Next unused byte of the chunk being carved
+    unsigned char              *p_end;    // End of the chunk being carved
+};
+
+struct tuple_intern_slot_s
+{
+    unsigned long long  hash;    // Hash of the tuple's elements
+    tuple              *p_tuple; // Canonical tuple, null if empty, or the stripe's tombstone
+};
+
+struct tuple_intern_stripe_s
+{
+    _Alignas(64) mutex          _lock;     // Guards the stripe
+    size_t                      capacity;  // Quantity of slots, a power of two
+    size_t                      count;     // Live tuples
+    size_t                      used;      // Live tuples and tombstones
+    struct tuple_intern_slot_s *_p_slots;  // Open addressed, linear probing
+};
+
+struct tuple_intern_table_s
+{
+    unsigned long long (*pfn_element_hash)(const void *const value);         // Content hash, or null for identity
+    int                (*pfn_compare)(const void *const a, const void *const b); // Content comparison, or null for identity
+    struct tuple_intern_stripe_s _stripes[TUPLE_INTERN_STRIPES];             // Sub tables, picked by the high bits of the hash
+};
+
+struct tuple_batch_s
+{
+    size_t  count;       // Quantity of tuples
+    tuple  *_p_tuples[]; // Handles, followed by the tuples themselves
+};
+
+struct tuple_node_s
+{
+    atomic_uint  references;                 // Trees and parent nodes that share this node
+    void        *_p_slots[TUPLE_NODE_WIDTH]; // Elements in a leaf, child nodes in a branch
+};
+
+struct tuple_tree_s
+{
+    struct tuple_node_s  *p_root; // Root node
+    unsigned int          shift;  // Index bits below the root. 0 when the root is a leaf
+    void       **_Atomic  p_flat; // Contiguous copy of the elements, made the first time one is needed
+};
+
+struct tuple_builder_s
+{
+    size_t  capacity; // Elements the buffer has room for
+    tuple  *p_tuple;  // The tuple being built. Its element count is the quantity pushed so far
+};
+
+struct tuple_stage_s
+{
+    void *(*pfn_map)(void *const value, size_t index);       // Replaces the element, or null for a filter
+    bool  (*pfn_predicate)(void *const value, size_t index); // Drops the element when false, or null for a map
+};
+
+struct tuple_pipeline_s
+{
+    tuple                *p_source;  // The tuple the pipeline reads. The pipeline holds a reference
+    size_t                count;     // Quantity of stages
+    size_t                capacity;  // Stages there is room for
+    size_t                filters;   // Quantity of filter stages
+    struct tuple_stage_s *_p_stages; // Stages, in the order they run
+};
+
+struct tuple_sort_s
+{
+    tuple                **pp_tuples;  // The tuples being sorted
+    const tuple_sort_key  *p_keys;     // Keys, most significant first
+    size_t                 keys;       // Quantity of keys
+    size_t                 width;      // Words in a row, the keys and then the tuple
+    size_t                 count;      // Quantity of rows
+    bool                   radix;      // Every key orders by address
+    void                 **p_rows;     // Sorted rows, once the sort is done
+    void                 **p_scratch;  // Rows being written by the current pass
+    uintptr_t             *p_diff;     // Per block, per key, bits that differ from the first row of the block
+    size_t                *p_counts;   // Per block digit counts, then where the block writes each digit
+    size_t                 key;        // Key the current radix pass orders by
+    unsigned int           shift;      // Bit offset of the current radix digit
+    size_t                 run;        // Length of the sorted runs the current merge pass joins
+    atomic_int             status;     // Set when a tuple is missing, or too short for a key
+};
+
+struct tuple_join_entry_s
+{
+    unsigned long long  key;     // The tuple's key, or a hash of its keys when there are several
+    const tuple        *p_tuple; // The tuple, so probing doesn't go back through the collection
+    size_t              size;    // Quantity of elements in the tuple
+};
+
+struct tuple_join_side_s
+{
+    const tuple *const        *pp_tuples;     // The tuples
+    size_t                     count;         // Quantity of tuples
+    const signed long long    *p_keys;        // Key positions
+    size_t                     blocks;        // Quantity of TUPLE_JOIN_BLOCK tuple blocks
+    struct tuple_join_entry_s *p_staged;      // Entries, in the order of the tuples
+    size_t                    *p_counts;      // Per block partition counts, then where the block writes each partition
+    struct tuple_join_entry_s *p_entries;     // Entries, grouped by partition
+    size_t                    *p_partitions;  // Where each partition starts in p_entries, and where the last one ends
+};
+
+struct tuple_join_s
+{
+    struct tuple_join_side_s  _sides[2];   // The left side, which probes, and the right side, which builds
+    size_t                    side;        // Side the current partitioning pass works on
+    size_t                    keys;        // Quantity of key positions on each side
+    unsigned int              bits;        // Hash bits the sides are partitioned on
+    size_t                    partitions;  // Quantity of partitions
+    tuple_join_mode           mode;        // Inner or left
+    bool                      parallel;    // Run passes on the worker pool
+    size_t                    pad;         // Null pointers after a left tuple that matched nothing
+    size_t                   *p_tables;    // Where each partition's buckets start in p_heads, and where the last one ends
+    size_t                   *p_heads;     // One past the first right entry in each bucket, or 0
+    size_t                   *p_next;      // One past the next right entry in the same bucket, or 0
+    size_t                   *p_outputs;   // Per partition, results, then the index of its first result
+    size_t                   *p_elements;  // Per partition, result elements, then the elements before its first result
+    struct tuple_batch_s     *p_batch;     // The results
+    unsigned char            *p_bodies;    // Where the first result starts in the batch
+    atomic_int                status;      // Set when a tuple is missing, too short for a key, or can't be flattened
+};
+
+struct tuple_table_s
+{
+    size_t   arity;    // Elements in each row
+    size_t   rows;     // Quantity of rows
+    size_t   capacity; // Rows each column has room for
+    void   **_p_data;  // Column c is the capacity elements starting at _p_data[c * capacity]
+};
+
+struct tuple_epoch_bag_s
+{
+    size_t   epoch;       // Epoch the tuples were retired in
+    size_t   count;       // Quantity of tuples
+    size_t   max;         // Capacity of the tuple array
+    tuple  **_p_tuples;   // Retired tuples
+};
+
+struct tuple_epoch_record_s
+{
+    atomic_size_t                state;                     // ( epoch << 1 ) | 1 while reading, 0 while quiescent
+    atomic_bool                  in_use;                    // Owned by a live thread
+    size_t                       nesting;                   // Depth of nested read sections
+    struct tuple_epoch_bag_s     _bags[TUPLE_EPOCH_BAGS];   // Tuples waiting for readers to move on
+    struct tuple_epoch_record_s *p_next;                    // Next record in the registry
+};
+
+struct tuple_parallel_range_s
+{
+    _Alignas(64) atomic_flag _lock; // Guards the range
+    size_t                   begin; // First index not yet claimed
+    size_t                   end;   // One past the last index not yet claimed
+    void                    *p_partial; // Reduction of every element this thread processed
+};
+
+struct tuple_parallel_job_s
+{
+    const tuple   *p_tuple;                                         // Tuple being iterated, or null for a range job
+    void         (*pfn_function)(void *const value, size_t index);  // Per element callback, or null when reducing
+    void        *(*pfn_map)(void *const value, size_t index);       // Per element map, when reducing
+    void        *(*pfn_reduce)(void *const left, void *const right);// Reduction, when reducing
+    void         (*pfn_range)(void *const p_context, size_t begin, size_t end); // Per chunk callback, for a range job
+    void          *p_context;                                       // Passed to pfn_range
+    size_t         length;                                          // Quantity of indices
+    size_t         grain;                                           // Elements claimed at once
+    size_t         threads;                                         // Caller and workers taking part
+    atomic_size_t  next;                                            // Next unclaimed range
+    struct tuple_parallel_range_s _ranges[TUPLE_WORKERS_MAX + 1];   // One range per thread, stolen from when empty
+};
+
+#ifndef _WIN64
+struct tuple_workers_s
 {
-    size_t   element_count; // Quantity of elements
-    void   *_p_elements[];  // Tuple contents
+    pthread_mutex_t              _job_lock;                    // Held by the caller for the length of a job
+    pthread_mutex_t              _lock;                        // Guards everything below
+    pthread_cond_t               _start;                       // Signalled when a job is posted
+    pthread_cond_t               _done;                        // Signalled when the last worker finishes
+    pthread_t                    _threads[TUPLE_WORKERS_MAX];  // Worker threads
+    size_t                       count;                        // Quantity of running workers
+    size_t                       requested;                    // Quantity of threads, caller included, 0 for one per processor
+    size_t                       generation;                   // Incremented for each job
+    size_t                       active;                       // Workers still on the current job
+    struct tuple_parallel_job_s *p_job;                        // Current job
+    bool                         stop;                         // Workers exit when set
 };
+#endif
 
 // Data
 static bool initialized = false;
+#ifndef _WIN64
+    static struct tuple_workers_s tuple_workers = { 0 };
+#endif
+static _Thread_local bool tuple_parallel_active = false;
+static mutex tuple_epoch_lock;
+static atomic_size_t tuple_epoch = 0;
+static struct tuple_epoch_record_s *_Atomic p_tuple_epoch_records = (void *) 0;
+static atomic_size_t tuple_epoch_orphans = 0;
+static _Thread_local struct tuple_epoch_record_s *p_tuple_epoch_record = (void *) 0;
+#ifndef _WIN64
+    static pthread_key_t tuple_epoch_key;
+    static pthread_key_t tuple_pool_key;
+#endif
+static _Thread_local struct tuple_pool_cache_s tuple_pool_cache = { 0 };
+static _Thread_local tuple_arena *p_tuple_arena = (void *) 0;
+static _Thread_local tuple_status tuple_status_value = TUPLE_STATUS_OK;
+static atomic_size_t tuple_log_max    = 0; // Messages per second, or 0 when logging is off
+static atomic_size_t tuple_log_count  = 0; // Messages logged in the current second
+static atomic_llong  tuple_log_second = 0; // The current second
+
+/** !
+ * Log a failure if the rate limit allows
+ * 
+ * @param format printf style format string
+ * @param list   format arguments
+ * 
+ * @return void
+ */
+static void tuple_log_v ( const char *const format, va_list list )
+{
+
+    // Initialized data
+    long long now                           = (long long) time((void *) 0),
+              second                        = atomic_load_explicit(&tuple_log_second, memory_order_relaxed);
+    char      _message[TUPLE_LOG_MESSAGE_MAX] = { 0 };
+
+    // Start a new second
+    if ( now != second && atomic_compare_exchange_strong(&tuple_log_second, &second, now) )
+        atomic_store_explicit(&tuple_log_count, 0, memory_order_relaxed);
+
+    // Rate limit
+    if ( atomic_fetch_add_explicit(&tuple_log_count, 1, memory_order_relaxed) >= atomic_load_explicit(&tuple_log_max, memory_order_relaxed) ) return;
+
+    // Format
+    vsnprintf(_message, sizeof(_message), format, list);
+
+    // Log
+    log_error("%s", _message);
+
+    // Done
+    return;
+}
+
+#ifndef NDEBUG
+/** !
+ * Log a failure if the rate limit allows
+ * 
+ * @param format printf style format string
+ * @param ...    format arguments
+ * 
+ * @return void
+ */
+static void tuple_log ( const char *const format, ... )
+{
+
+    // Uninitialized data
+    va_list list;
+
+    // Log
+    va_start(list, format);
+    tuple_log_v(format, list);
+    va_end(list);
+
+    // Done
+    return;
+}
+#endif
+
+/** !
+ * Mark a thread's epoch record as free for the next thread to use. Deferred tuples stay in
+ * the record's bags, labelled with their epoch, until the next tuple_reclaim, the next owner,
+ * or tuple_exit frees them
+ * 
+ * @param p_record the record
+ * 
+ * @return void
+ */
+static void tuple_epoch_unregister ( void *p_record )
+{
+
+    // Initialized data
+    struct tuple_epoch_record_s *p_epoch_record = p_record;
+
+    // The thread is no longer reading
+    p_epoch_record->nesting = 0;
+    atomic_store_explicit(&p_epoch_record->state, 0, memory_order_release);
+
+    // Free the record for reuse
+    mutex_lock(&tuple_epoch_lock);
+    atomic_store_explicit(&p_epoch_record->in_use, false, memory_order_relaxed);
+
+    // Hand leftover tuples to the next tuple_reclaim
+    for (size_t i = 0; i < TUPLE_EPOCH_BAGS; i++)
+        if ( p_epoch_record->_bags[i].count ) { atomic_fetch_add_explicit(&tuple_epoch_orphans, 1, memory_order_relaxed); break; }
+
+    // Unlock
+    mutex_unlock(&tuple_epoch_lock);
+
+    // Done
+    return;
+}
+
+/** !
+ * Give a thread's cached pool blocks back to its pool when the thread exits attached
+ * 
+ * @param p_cache the thread's cache
+ * 
+ * @return void
+ */
+static void tuple_pool_detach ( void *p_cache )
+{
+
+    // Unused
+    (void) p_cache;
+
+    // Flush the cache, and detach
+    tuple_pool_attach((void *) 0);
+
+    // Done
+    return;
+}
 
 void tuple_init ( void ) 
 {
@@ -28,6 +498,27 @@ void tuple_init ( void )
     // Initialize the log library
     log_init();
 
+    // Guard the epoch registry
+    mutex_create(&tuple_epoch_lock);
+
+    // Hand a thread's epoch record back when the thread exits
+    #ifndef _WIN64
+        pthread_key_create(&tuple_epoch_key, tuple_epoch_unregister);
+    #endif
+
+    // Flush a thread's cached pool blocks when the thread exits
+    #ifndef _WIN64
+        pthread_key_create(&tuple_pool_key, tuple_pool_detach);
+    #endif
+
+    // Worker pool. The threads are started by the first parallel call
+    #ifndef _WIN64
+        pthread_mutex_init(&tuple_workers._job_lock, 0);
+        pthread_mutex_init(&tuple_workers._lock, 0);
+        pthread_cond_init(&tuple_workers._start, 0);
+        pthread_cond_init(&tuple_workers._done, 0);
+    #endif
+
     // Set the initialized flag
     initialized = true;
 
@@ -35,24 +526,7691 @@ void tuple_init ( void )
     return;
 }
 
-// Function declarations
-int tuple_create ( tuple **const pp_tuple )
+/** !
+ * Get the size class of a tuple with size elements
+ * 
+ * @param size number of elements in the tuple
+ * 
+ * @return the size class. Tuples too large for any class yield TUPLE_POOL_CLASSES or more
+ */
+static size_t tuple_pool_class ( size_t size )
+{
+
+    // Initialized data
+    size_t size_class = TUPLE_POOL_EXACT_CLASSES,
+           capacity   = 32;
+
+    // Small tuples get an exact class
+    if ( size < TUPLE_POOL_EXACT_CLASSES ) return size;
+
+    // Larger tuples are rounded up to a power of two
+    while ( capacity < size && size_class < TUPLE_POOL_CLASSES ) capacity <<= 1, size_class++;
+
+    // Success
+    return size_class;
+}
+
+/** !
+ * Get the size of a pool block in bytes, including the block header
+ * 
+ * @param size_class the size class
+ * 
+ * @return size of the block in bytes
+ */
+static size_t tuple_pool_block_size ( size_t size_class )
+{
+
+    // Initialized data
+    size_t capacity = ( size_class < TUPLE_POOL_EXACT_CLASSES ) ? size_class : ( (size_t) 32 << ( size_class - TUPLE_POOL_EXACT_CLASSES ) );
+
+    // Success
+    return sizeof(struct tuple_pool_block_s) + sizeof(tuple) + ( capacity * sizeof(void *) );
+}
+
+/** !
+ * Drop the calling thread's free lists if the attached pool was reset since they were filled
+ * 
+ * @param p_cache the calling thread's cache
+ * 
+ * @return void
+ */
+static void tuple_pool_cache_validate ( struct tuple_pool_cache_s *p_cache )
+{
+
+    // Initialized data
+    size_t generation = atomic_load_explicit(&p_cache->p_pool->generation, memory_order_acquire);
+
+    // Fast exit
+    if ( p_cache->generation == generation ) return;
+
+    // The blocks belonged to slabs that no longer exist
+    memset(p_cache->_p_free, 0, sizeof(p_cache->_p_free));
+    memset(p_cache->_count , 0, sizeof(p_cache->_count));
+
+    // Update the generation
+    p_cache->generation = generation;
+
+    // Done
+    return;
+}
+
+/** !
+ * Move up to quantity blocks of one size class from the calling thread's cache to the shared free list
+ * 
+ * @param p_cache    the calling thread's cache
+ * @param size_class the size class
+ * @param quantity   the maximum quantity of blocks to move
+ * 
+ * @return void
+ */
+static void tuple_pool_cache_flush ( struct tuple_pool_cache_s *p_cache, size_t size_class, size_t quantity )
+{
+
+    // Initialized data
+    tuple_pool *p_pool = p_cache->p_pool;
+
+    // Lock
+    mutex_lock(&p_pool->_lock);
+
+    // Move blocks to the shared free list
+    while ( quantity-- && p_cache->_p_free[size_class] )
+    {
+
+        // Initialized data
+        struct tuple_pool_block_s *p_block = p_cache->_p_free[size_class];
+
+        // Pop from the thread
+        p_cache->_p_free[size_class] = p_block->p_next;
+        p_cache->_count[size_class]--;
+
+        // Push to the pool
+        p_block->p_next             = p_pool->_p_free[size_class];
+        p_pool->_p_free[size_class] = p_block;
+    }
+
+    // Unlock
+    mutex_unlock(&p_pool->_lock);
+
+    // Done
+    return;
+}
+
+/** !
+ * Fill the calling thread's cache with a batch of blocks of one size class, from the shared
+ * free list first, and from a new slab when that runs dry
+ * 
+ * @param p_cache    the calling thread's cache
+ * @param size_class the size class
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int tuple_pool_cache_refill ( struct tuple_pool_cache_s *p_cache, size_t size_class )
+{
+
+    // Initialized data
+    tuple_pool *p_pool     = p_cache->p_pool;
+    size_t      block_size = tuple_pool_block_size(size_class);
+
+    // Lock
+    mutex_lock(&p_pool->_lock);
+
+    // Take blocks from the shared free list ...
+    while ( p_cache->_count[size_class] < TUPLE_POOL_BATCH && p_pool->_p_free[size_class] )
+    {
+
+        // Initialized data
+        struct tuple_pool_block_s *p_block = p_pool->_p_free[size_class];
+
+        // Pop from the pool
+        p_pool->_p_free[size_class] = p_block->p_next;
+
+        // Push to the thread
+        p_block->p_next               = p_cache->_p_free[size_class];
+        p_cache->_p_free[size_class] = p_block;
+        p_cache->_count[size_class]++;
+    }
+
+    // ... and carve the rest out of a slab
+    while ( p_cache->_count[size_class] < TUPLE_POOL_BATCH )
+    {
+
+        // Initialized data
+        struct tuple_pool_block_s *p_block = (void *) 0;
+
+        // Start a new slab if the active one is spent
+        if ( (size_t) ( p_pool->_p_end[size_class] - p_pool->_p_cursor[size_class] ) < block_size )
+        {
+
+            // Initialized data
+            size_t                    slab_size = sizeof(struct tuple_pool_slab_s) + ( ( block_size * TUPLE_POOL_SLAB_BLOCKS > TUPLE_POOL_SLAB_SIZE ) ? block_size * TUPLE_POOL_SLAB_BLOCKS : TUPLE_POOL_SLAB_SIZE );
+            struct tuple_pool_slab_s *p_slab    = TUPLE_REALLOC(0, slab_size);
+
+            // Error check
+            if ( p_slab == (void *) 0 ) break;
+
+            // Keep track of the slab
+            p_slab->p_next  = p_pool->p_slabs;
+            p_slab->_size   = slab_size;
+            p_pool->p_slabs = p_slab;
+
+            // Make it the active slab
+            p_pool->_p_cursor[size_class] = (unsigned char *) ( p_slab + 1 );
+            p_pool->_p_end[size_class]    = (unsigned char *) p_slab + slab_size;
+        }
+
+        // Carve a block
+        p_block = (struct tuple_pool_block_s *) p_pool->_p_cursor[size_class];
+        p_pool->_p_cursor[size_class] += block_size;
+
+        // Push to the thread
+        p_block->size_class           = size_class;
+        p_block->p_next               = p_cache->_p_free[size_class];
+        p_cache->_p_free[size_class] = p_block;
+        p_cache->_count[size_class]++;
+    }
+
+    // Unlock
+    mutex_unlock(&p_pool->_lock);
+
+    // Success if the thread has at least one block
+    return ( p_cache->_p_free[size_class] != (void *) 0 );
+}
+
+/** !
+ * Draw a tuple with room for size elements from the pool attached to the calling thread
+ * 
+ * @param size number of elements in the tuple
+ * 
+ * @return pointer to tuple on success, null pointer on error
+ */
+static tuple *tuple_pool_allocate ( size_t size )
+{
+
+    // Initialized data
+    struct tuple_pool_cache_s *p_cache    = &tuple_pool_cache;
+    struct tuple_pool_block_s *p_block    = (void *) 0;
+    size_t                     size_class = tuple_pool_class(size);
+    tuple                     *p_tuple    = (void *) 0;
+
+    // Drop stale blocks
+    tuple_pool_cache_validate(p_cache);
+
+    // Refill the free list
+    if ( p_cache->_p_free[size_class] == (void *) 0 )
+        if ( tuple_pool_cache_refill(p_cache, size_class) == 0 ) return (void *) 0;
+
+    // Pop a block
+    p_block = p_cache->_p_free[size_class];
+    p_cache->_p_free[size_class] = p_block->p_next;
+    p_cache->_count[size_class]--;
+
+    // Remember where it came from
+    p_block->p_pool = p_cache->p_pool;
+
+    // The tuple follows the block header
+    p_tuple = (tuple *) ( p_block + 1 );
+    p_tuple->_flags = TUPLE_FLAG_POOL;
+
+    // Success
+    return p_tuple;
+}
+
+/** !
+ * Return a pool tuple to its pool. The block goes to the calling thread's free list if the
+ * thread is attached to the owning pool, and to the pool's shared free list otherwise
+ * 
+ * @param p_tuple the tuple
+ * 
+ * @return void
+ */
+static void tuple_pool_deallocate ( tuple *p_tuple )
+{
+
+    // Initialized data
+    struct tuple_pool_cache_s *p_cache    = &tuple_pool_cache;
+    struct tuple_pool_block_s *p_block    = ( (struct tuple_pool_block_s *) p_tuple ) - 1;
+    tuple_pool                *p_pool     = p_block->p_pool;
+    size_t                     size_class = p_block->size_class;
+
+    // Return the block to the calling thread ...
+    if ( p_cache->p_pool == p_pool )
+    {
+
+        // Drop stale blocks
+        tuple_pool_cache_validate(p_cache);
+
+        // Push to the thread
+        p_block->p_next               = p_cache->_p_free[size_class];
+        p_cache->_p_free[size_class] = p_block;
+        p_cache->_count[size_class]++;
+
+        // Give a batch back to the pool if the thread is holding too many
+        if ( p_cache->_count[size_class] > TUPLE_POOL_CACHE_MAX )
+            tuple_pool_cache_flush(p_cache, size_class, TUPLE_POOL_BATCH);
+
+        // Done
+        return;
+    }
+
+    // ... or to the shared free list
+    mutex_lock(&p_pool->_lock);
+
+    // Push to the pool
+    p_block->p_next             = p_pool->_p_free[size_class];
+    p_pool->_p_free[size_class] = p_block;
+
+    // Unlock
+    mutex_unlock(&p_pool->_lock);
+
+    // Done
+    return;
+}
+
+/** !
+ * Bump allocate a tuple with room for size elements from the arena attached to the calling
+ * thread. Chunks left over from before the last reset are reused before new ones are made
+ * 
+ * @param size number of elements in the tuple
+ * 
+ * @return pointer to tuple on success, null pointer on error
+ */
+static tuple *tuple_arena_allocate ( size_t size )
+{
+
+    // Initialized data
+    tuple_arena *p_arena = p_tuple_arena;
+    size_t       bytes   = sizeof(tuple) + ( size * sizeof(void *) );
+    tuple       *p_tuple = (void *) 0;
+
+    // Move on to another chunk if this one is spent
+    if ( (size_t) ( p_arena->p_end - p_arena->p_cursor ) < bytes )
+    {
+
+        // Initialized data
+        struct tuple_arena_chunk_s *p_next = ( p_arena->p_chunk ) ? p_arena->p_chunk->p_next : p_arena->p_head;
+
+        // Make a new chunk if the next one is missing or too small
+        if ( p_next == (void *) 0 || p_next->_size - sizeof(struct tuple_arena_chunk_s) < bytes )
+        {
+
+            // Initialized data
+            size_t chunk_size = sizeof(struct tuple_arena_chunk_s) + ( ( bytes > TUPLE_ARENA_CHUNK_SIZE ) ? bytes : TUPLE_ARENA_CHUNK_SIZE );
+
+            // Allocate a chunk
+            struct tuple_arena_chunk_s *p_new = TUPLE_REALLOC(0, chunk_size);
+
+            // Error check
+            if ( p_new == (void *) 0 ) return (void *) 0;
+
+            // Link it in after the current chunk
+            p_new->_size  = chunk_size;
+            p_new->p_next = p_next;
+
+            // First chunk
+            if   ( p_arena->p_chunk == (void *) 0 ) p_arena->p_head          = p_new;
+            else                                    p_arena->p_chunk->p_next = p_new;
+
+            // Carve from the new chunk
+            p_next = p_new;
+        }
+
+        // Make it the chunk being carved
+        p_arena->p_chunk  = p_next;
+        p_arena->p_cursor = (unsigned char *) ( p_next + 1 );
+        p_arena->p_end    = (unsigned char *) p_next + p_next->_size;
+    }
+
+    // Bump
+    p_tuple = (tuple *) p_arena->p_cursor;
+    p_arena->p_cursor += bytes;
+
+    // Set the storage flags
+    p_tuple->_flags = TUPLE_FLAG_ARENA;
+
+    // Success
+    return p_tuple;
+}
+
+/** !
+ * Multiply two 64 bit integers, and fold the 128 bit product into 64 bits
+ * 
+ * @param a first factor
+ * @param b second factor
+ * 
+ * @return low half of the product xor the high half
+ */
+static inline unsigned long long tuple_hash_mix ( unsigned long long a, unsigned long long b )
+{
+
+    // Compilers with 128 bit integers do this in one instruction
+    #ifdef __SIZEOF_INT128__
+
+        // Initialized data
+        unsigned __int128 product = (unsigned __int128) a * b;
+
+        // Fold
+        return (unsigned long long) product ^ (unsigned long long) ( product >> 64 );
+    #else
+
+        // Initialized data
+        unsigned long long a_lo = a & 0xffffffff, a_hi = a >> 32,
+                           b_lo = b & 0xffffffff, b_hi = b >> 32,
+                           lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo,
+                           lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi,
+                           cross = ( lo_lo >> 32 ) + ( hi_lo & 0xffffffff ) + lo_hi,
+                           upper = ( hi_lo >> 32 ) + ( cross >> 32 ) + hi_hi,
+                           lower = ( cross << 32 ) | ( lo_lo & 0xffffffff );
+
+        // Fold
+        return lower ^ upper;
+    #endif
+}
+
+/** !
+ * Hash a run of elements. Elements are taken four at a time into four independent
+ * accumulators, xxh3 style, so the main loop has no carried dependency between lanes and
+ * compilers vectorize it. The key for each lane changes with its position, so reordering
+ * elements changes the hash
+ * 
+ * @param p_elements       the elements
+ * @param count            quantity of elements
+ * @param pfn_element_hash hashes an element's contents, or null to hash the pointers themselves
+ * 
+ * @return the hash
+ */
+static unsigned long long tuple_hash_elements ( void *const *p_elements, size_t count, unsigned long long (*pfn_element_hash)(const void *const value) )
+{
+
+    // Initialized data
+    static const unsigned long long _secret[4] = { 0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL };
+    unsigned long long              _acc[4]    = { _secret[0] ^ count, _secret[1], _secret[2], _secret[3] };
+    size_t                          i          = 0;
+
+    // Stripes of four lanes
+    for (; i + 4 <= count; i += 4)
+    {
+
+        // Initialized data
+        unsigned long long _lanes[4];
+
+        // Load the lanes
+        if ( pfn_element_hash )
+            for (size_t j = 0; j < 4; j++) _lanes[j] = pfn_element_hash(p_elements[i + j]);
+        else
+            for (size_t j = 0; j < 4; j++) _lanes[j] = (unsigned long long) (size_t) p_elements[i + j];
+
+        // Accumulate. The product of the low and high halves of the keyed lane mixes it, and
+        // adding the lane back keeps a zero half from erasing it
+        for (size_t j = 0; j < 4; j++)
+        {
+
+            // Initialized data
+            unsigned long long keyed = _lanes[j] ^ ( _secret[j] + i );
+
+            // Accumulate
+            _acc[j] += ( keyed & 0xffffffff ) * ( keyed >> 32 ) + _lanes[j];
+        }
+    }
+
+    // The last few elements
+    for (; i < count; i++)
+    {
+
+        // Initialized data
+        unsigned long long lane = ( pfn_element_hash ) ? pfn_element_hash(p_elements[i]) : (unsigned long long) (size_t) p_elements[i];
+
+        // Mix it into its accumulator
+        _acc[i & 3] = tuple_hash_mix(_acc[i & 3] ^ lane, _secret[i & 3] + i);
+    }
+
+    // Fold the accumulators together
+    return tuple_hash_mix(tuple_hash_mix(_acc[0], _acc[1]) ^ tuple_hash_mix(_acc[2], _acc[3]), _secret[0] ^ count);
+}
+
+/** !
+ * Move an identity hash off the values a hash slot reserves
+ * 
+ * @param hash identity hash
+ * 
+ * @return the hash, or its neighbour if it is TUPLE_HASH_NONE or TUPLE_HASH_UPDATED
+ */
+static inline unsigned long long tuple_hash_identity ( unsigned long long hash )
+{
+
+    // Success
+    return ( hash == TUPLE_HASH_NONE ) ? hash + 1 : ( hash == TUPLE_HASH_UPDATED ) ? hash - 1 : hash;
+}
+
+/** !
+ * Find the first position where two runs of pointers differ. Blocks of 64 are checked with
+ * the C library's vectorized memcmp, and only a block with a difference is scanned element
+ * by element
+ * 
+ * @param p_a   first run
+ * @param p_b   second run
+ * @param count quantity of elements in each
+ * 
+ * @return index of the first difference, or count if the runs are identical
+ */
+static size_t tuple_mismatch ( void *const *p_a, void *const *p_b, size_t count )
+{
+
+    // Initialized data
+    size_t i = 0;
+
+    // Blocks of 64
+    for (; i + 64 <= count; i += 64)
+
+        // Found the block
+        if ( memcmp(&p_a[i], &p_b[i], 64 * sizeof(void *)) ) break;
+
+    // Scan what is left
+    for (; i < count; i++) if ( p_a[i] != p_b[i] ) break;
+
+    // Done
+    return i;
+}
+
+/** !
+ * Compare two runs of elements lexicographically. A run that is a prefix of the other
+ * orders first
+ * 
+ * @param p_a         first run
+ * @param a_count     quantity of elements in the first run
+ * @param p_b         second run
+ * @param b_count     quantity of elements in the second run
+ * @param pfn_compare orders two elements by content, or null to order by address
+ * 
+ * @return negative if a orders first, 0 if the runs are equal, positive if b orders first
+ */
+static int tuple_compare_elements ( void *const *p_a, size_t a_count, void *const *p_b, size_t b_count, int (*pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Initialized data
+    size_t count = ( a_count < b_count ) ? a_count : b_count;
+
+    // Order by address
+    if ( pfn_compare == (void *) 0 )
+    {
+
+        // Initialized data
+        size_t i = tuple_mismatch(p_a, p_b, count);
+
+        // The first differing pair decides
+        if ( i < count ) return ( (size_t) p_a[i] < (size_t) p_b[i] ) ? -1 : 1;
+    }
+
+    // Order by content
+    else
+        for (size_t i = 0; i < count; i++)
+        {
+
+            // Initialized data
+            int result = ( p_a[i] == p_b[i] ) ? 0 : pfn_compare(p_a[i], p_b[i]);
+
+            // The first differing pair decides
+            if ( result ) return result;
+        }
+
+    // The shorter run orders first
+    return ( a_count > b_count ) - ( a_count < b_count );
+}
+
+/** !
+ * Test two runs of elements for equality
+ * 
+ * @param p_a         first run
+ * @param a_count     quantity of elements in the first run
+ * @param p_b         second run
+ * @param b_count     quantity of elements in the second run
+ * @param pfn_compare orders two elements by content, or null to compare addresses
+ * 
+ * @return true if the runs are equal, else false
+ */
+static bool tuple_equals_elements ( void *const *p_a, size_t a_count, void *const *p_b, size_t b_count, int (*pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Fast exit
+    if ( a_count != b_count ) return false;
+    if ( p_a     == p_b     ) return true;
+
+    // Compare addresses with the C library's vectorized memcmp
+    if ( pfn_compare == (void *) 0 ) return memcmp(p_a, p_b, a_count * sizeof(void *)) == 0;
+
+    // Compare contents
+    return tuple_compare_elements(p_a, a_count, p_b, b_count, pfn_compare) == 0;
+}
+
+/** !
+ * Test a block of 8 elements for an address, with vector compares where the target has them.
+ * A block may be reported that doesn't hold the address, so callers check the block again
+ * 
+ * @param p_elements block of 8 elements
+ * @param value      the address
+ * 
+ * @return true if the block may hold the address, else false
+ */
+static inline bool tuple_search_block ( void *const *p_elements, const void *value )
+{
+
+    #if defined(TUPLE_SIMD_AVX2)
+
+        // Initialized data
+        __m256i key = _mm256_set1_epi64x((long long) (uintptr_t) value);
+
+        // Two compares of 4 lanes
+        return _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *) &p_elements[0]), key),
+            _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *) &p_elements[4]), key)
+        )) != 0;
+    #elif defined(TUPLE_SIMD_SSE2)
+
+        // Initialized data
+        __m128i key = _mm_set1_epi64x((long long) (uintptr_t) value),
+                any = _mm_setzero_si128();
+
+        // SSE2 has no 64 bit compare. Compare 32 bit halves, and merge the blocks first
+        for (int i = 0; i < 8; i += 2) any = _mm_or_si128(any, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) &p_elements[i]), key));
+
+        // Some lane had both halves match, though maybe not in the same element
+        return _mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(any, _mm_shuffle_epi32(any, _MM_SHUFFLE(2, 3, 0, 1))))) != 0;
+    #elif defined(TUPLE_SIMD_NEON)
+
+        // Initialized data
+        uint64x2_t key = vdupq_n_u64((uint64_t) (uintptr_t) value),
+                   any = vdupq_n_u64(0);
+
+        // Four compares of 2 lanes
+        for (int i = 0; i < 8; i += 2) any = vorrq_u64(any, vceqq_u64(vld1q_u64((const uint64_t *) &p_elements[i]), key));
+
+        // Any lane
+        return ( vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1) ) != 0;
+    #else
+
+        // Initialized data
+        bool hit = false;
+
+        // One element at a time, without branches
+        for (int i = 0; i < 8; i++) hit |= ( p_elements[i] == value );
+
+        // Done
+        return hit;
+    #endif
+}
+
+/** !
+ * Find the first element with a given address
+ * 
+ * @param p_elements run of elements
+ * @param count      quantity of elements
+ * @param value      the address
+ * 
+ * @return offset of the first match, or count if there is none
+ */
+static size_t tuple_search ( void *const *p_elements, size_t count, const void *value )
+{
+
+    // Initialized data
+    size_t i = 0;
+
+    // Blocks of 8
+    for (; i + 8 <= count; i += 8)
+
+        // Check the block
+        if ( tuple_search_block(&p_elements[i], value) )
+            for (size_t j = i; j < i + 8; j++) if ( p_elements[j] == value ) return j;
+
+    // Scan what is left
+    for (; i < count; i++) if ( p_elements[i] == value ) break;
+
+    // Done
+    return i;
+}
+
+/** !
+ * Find the last element with a given address
+ * 
+ * @param p_elements run of elements
+ * @param count      quantity of elements
+ * @param value      the address
+ * 
+ * @return offset of the last match, or count if there is none
+ */
+static size_t tuple_search_last ( void *const *p_elements, size_t count, const void *value )
+{
+
+    // Initialized data
+    size_t i = count;
+
+    // Blocks of 8, from the back
+    for (; i >= 8; i -= 8)
+
+        // Check the block
+        if ( tuple_search_block(&p_elements[i - 8], value) )
+            for (size_t j = i; j > i - 8; j--) if ( p_elements[j - 1] == value ) return j - 1;
+
+    // Scan what is left
+    for (; i > 0; i--) if ( p_elements[i - 1] == value ) return i - 1;
+
+    // Not found
+    return count;
+}
+
+/** !
+ * Count the elements with a given address
+ * 
+ * @param p_elements run of elements
+ * @param count      quantity of elements
+ * @param value      the address
+ * 
+ * @return quantity of matches
+ */
+static size_t tuple_search_count ( void *const *p_elements, size_t count, const void *value )
+{
+
+    // Initialized data
+    size_t i       = 0,
+           matches = 0;
+
+    #if defined(TUPLE_SIMD_AVX2)
+
+        // Initialized data
+        __m256i key = _mm256_set1_epi64x((long long) (uintptr_t) value),
+                sum = _mm256_setzero_si256();
+
+        // Matching lanes are -1, so subtracting them counts them
+        for (; i + 4 <= count; i += 4) sum = _mm256_sub_epi64(sum, _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *) &p_elements[i]), key));
+
+        // Add the lanes
+        matches = (size_t) ( _mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) + _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3) );
+    #elif defined(TUPLE_SIMD_SSE2)
+
+        // Initialized data
+        __m128i key = _mm_set1_epi64x((long long) (uintptr_t) value),
+                sum = _mm_setzero_si128();
+
+        // A lane matches when both of its 32 bit halves do. Matching lanes are -1, so subtracting them counts them
+        for (; i + 2 <= count; i += 2)
+        {
+
+            // Initialized data
+            __m128i halves = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) &p_elements[i]), key);
+
+            // Count both halves
+            sum = _mm_sub_epi64(sum, _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))));
+        }
+
+        // Add the lanes
+        matches = (size_t) ( _mm_cvtsi128_si64(sum) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sum, sum)) );
+    #elif defined(TUPLE_SIMD_NEON)
+
+        // Initialized data
+        uint64x2_t key = vdupq_n_u64((uint64_t) (uintptr_t) value),
+                   sum = vdupq_n_u64(0);
+
+        // Matching lanes are all ones, so subtracting them counts them
+        for (; i + 2 <= count; i += 2) sum = vsubq_u64(sum, vceqq_u64(vld1q_u64((const uint64_t *) &p_elements[i]), key));
+
+        // Add the lanes
+        matches = (size_t) vaddvq_u64(sum);
+    #endif
+
+    // Count what is left
+    for (; i < count; i++) matches += ( p_elements[i] == value );
+
+    // Done
+    return matches;
+}
+
+/** !
+ * Turn a signed index into an offset from the front of a sequence of length elements.
+ * If index is negative, index = length - |index|
+ * 
+ * @param index    signed index
+ * @param length   quantity of elements
+ * @param p_offset return
+ * 
+ * @return 1 if the index is in bounds, 0 otherwise
+ */
+static int tuple_offset ( signed long long index, size_t length, size_t *const p_offset )
+{
+
+    // Positive index
+    if ( index >= 0 )
+    {
+
+        // Bounds check
+        if ( (unsigned long long) index >= length ) return 0;
+
+        // Done
+        *p_offset = (size_t) index;
+    }
+
+    // Negative index
+    else
+    {
+
+        // Bounds check
+        if ( (unsigned long long) -( index + 1 ) >= length ) return 0;
+
+        // Done
+        *p_offset = length - (size_t) -( index + 1 ) - 1;
+    }
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Turn a batch of signed indices into offsets from the front of a sequence of length
+ * elements, with one bounds check for the whole batch
+ * 
+ * @param indices   signed indices
+ * @param count     quantity of indices
+ * @param length    quantity of elements
+ * @param p_offsets return count offsets, each stored as a pointer sized integer
+ * 
+ * @return 1 if every index is in bounds, 0 otherwise
+ */
+static int tuple_offsets ( const signed long long *indices, size_t count, size_t length, void **p_offsets )
+{
+
+    // Initialized data
+    size_t i   = 0;
+    bool   bad = false;
+
+    #if defined(TUPLE_SIMD_AVX2)
+
+        // Initialized data
+        __m256i zero   = _mm256_setzero_si256(),
+                bound  = _mm256_set1_epi64x((long long) length),
+                inside = _mm256_cmpeq_epi64(zero, zero);
+
+        // Four indices at a time. Negative lanes get the length added
+        for (; i + 4 <= count; i += 4)
+        {
+
+            // Initialized data
+            __m256i index  = _mm256_loadu_si256((const __m256i *) &indices[i]),
+                    offset = _mm256_add_epi64(index, _mm256_and_si256(_mm256_cmpgt_epi64(zero, index), bound));
+
+            // Lanes that are still negative, or not less than the length, are out of bounds
+            inside = _mm256_and_si256(inside, _mm256_andnot_si256(_mm256_cmpgt_epi64(zero, offset), _mm256_cmpgt_epi64(bound, offset)));
+
+            // Store the offsets
+            _mm256_storeu_si256((__m256i *) &p_offsets[i], offset);
+        }
+
+        // Any lane out of bounds
+        bad = _mm256_movemask_epi8(inside) != -1;
+    #endif
+
+    // One index at a time, without branches. Out of bounds indices wrap past the length
+    for (; i < count; i++)
+    {
+
+        // Initialized data
+        size_t offset = (size_t) indices[i] + ( ( indices[i] < 0 ) ? length : 0 );
+
+        // Store the offset
+        p_offsets[i]  = (void *) (uintptr_t) offset;
+        bad          |= ( offset >= length );
+    }
+
+    // Done
+    return bad == false;
+}
+
+/** !
+ * Allocate a tuple with room for size elements and a hash slot from the arena or the pool
+ * attached to the calling thread, or else in exactly one call to TUPLE_REALLOC. The element
+ * count and the storage flags are set, the element storage is left uninitialized for the caller
+ * 
+ * @param size number of elements in the tuple
+ * 
+ * @return pointer to tuple on success, null pointer on error
+ */
+static tuple *tuple_allocate ( size_t size )
+{
+
+    // Initialized data
+    tuple *p_tuple = (void *) 0;
+
+    // Overflow check
+    if ( size > ( ( (size_t) -1 - sizeof(tuple) ) / sizeof(void *) ) - TUPLE_HASH_SLOTS ) return (void *) 0;
+
+    // Draw from the attached arena ...
+    if ( p_tuple_arena )
+        p_tuple = tuple_arena_allocate(size + TUPLE_HASH_SLOTS);
+
+    // ... or the attached pool ...
+    else if ( tuple_pool_cache.p_pool && tuple_pool_class(size + TUPLE_HASH_SLOTS) < TUPLE_POOL_CLASSES )
+        p_tuple = tuple_pool_allocate(size + TUPLE_HASH_SLOTS);
+
+    // ... or allocate the header, the element storage and the hash slot together
+    else if ( ( p_tuple = TUPLE_REALLOC(0, sizeof(tuple) + ( ( size + TUPLE_HASH_SLOTS ) * sizeof(void *) ) ) ) )
+        p_tuple->_flags = 0;
+
+    // Error check
+    if ( p_tuple == (void *) 0 ) return (void *) 0;
+
+    // Set the quantity of elements, stored after the header
+    p_tuple->element_count  = size;
+    p_tuple->_flags        |= TUPLE_FLAG_HASH;
+
+    // The caller owns the only reference, and nothing is hashed yet
+    atomic_init(&p_tuple->_references, 1);
+    atomic_init(tuple_hash_slot(p_tuple), TUPLE_HASH_NONE);
+
+    // Success
+    return p_tuple;
+}
+
+/** !
+ * Give up one reference to a node, and free it and its unshared children if that was the last
+ * 
+ * @param p_node the node
+ * @param shift  index bits below the node
+ * 
+ * @return void
+ */
+static void tuple_node_release ( struct tuple_node_s *p_node, unsigned int shift )
+{
+
+    // Someone else still shares the node
+    if ( atomic_fetch_sub_explicit(&p_node->references, 1, memory_order_acq_rel) != 1 ) return;
+
+    // Release the children of a branch
+    if ( shift )
+        for (size_t i = 0; i < TUPLE_NODE_WIDTH; i++)
+            if ( p_node->_p_slots[i] ) tuple_node_release(p_node->_p_slots[i], shift - TUPLE_NODE_BITS);
+
+    // Free the node
+    p_node = TUPLE_REALLOC(p_node, 0);
+
+    // Done
+    return;
+}
+
+/** !
+ * Build the node that holds count elements, with shift index bits below it
+ * 
+ * @param elements the elements
+ * @param count    quantity of elements under the node
+ * @param shift    index bits below the node
+ * 
+ * @return the node on success, null pointer on error
+ */
+static struct tuple_node_s *tuple_node_build ( void *const *elements, size_t count, unsigned int shift )
+{
+
+    // Initialized data
+    struct tuple_node_s *p_node = TUPLE_REALLOC(0, sizeof(struct tuple_node_s));
+    size_t               step   = (size_t) 1 << shift;
+
+    // Error check
+    if ( p_node == (void *) 0 ) return (void *) 0;
+
+    // Unused slots are null
+    atomic_init(&p_node->references, 1);
+    memset(p_node->_p_slots, 0, sizeof(p_node->_p_slots));
+
+    // A leaf holds the elements themselves
+    if ( shift == 0 )
+    {
+        memcpy(p_node->_p_slots, elements, count * sizeof(void *));
+        return p_node;
+    }
+
+    // A branch holds a child for each step elements
+    for (size_t i = 0; i * step < count; i++)
+    {
+
+        // Build the child
+        p_node->_p_slots[i] = tuple_node_build(&elements[i * step], ( count - i * step < step ) ? count - i * step : step, shift - TUPLE_NODE_BITS);
+
+        // Error check
+        if ( p_node->_p_slots[i] == (void *) 0 ) goto failed;
+    }
+
+    // Success
+    return p_node;
+
+    // The children built so far go with the node
+    failed:
+        tuple_node_release(p_node, shift);
+
+        // Error
+        return (void *) 0;
+}
+
+/** !
+ * Copy the path from a node to one element, changing the element in the copy. Every node off
+ * the path is shared with the original
+ * 
+ * @param p_node the node
+ * @param shift  index bits below the node
+ * @param offset the element's offset
+ * @param value  the element's new value
+ * 
+ * @return the copy on success, null pointer on error
+ */
+static struct tuple_node_s *tuple_node_with ( const struct tuple_node_s *p_node, unsigned int shift, size_t offset, void *value )
+{
+
+    // Initialized data
+    struct tuple_node_s *p_copy = TUPLE_REALLOC(0, sizeof(struct tuple_node_s));
+    size_t               slot   = ( offset >> shift ) & TUPLE_NODE_MASK;
+
+    // Error check
+    if ( p_copy == (void *) 0 ) return (void *) 0;
+
+    // Copy the slots
+    atomic_init(&p_copy->references, 1);
+    memcpy(p_copy->_p_slots, p_node->_p_slots, sizeof(p_copy->_p_slots));
+
+    // Change the element in a leaf ...
+    if ( shift == 0 )
+    {
+        p_copy->_p_slots[slot] = value;
+        return p_copy;
+    }
+
+    // ... or copy the child on the path
+    p_copy->_p_slots[slot] = tuple_node_with(p_node->_p_slots[slot], shift - TUPLE_NODE_BITS, offset, value);
+
+    // Error check
+    if ( p_copy->_p_slots[slot] == (void *) 0 )
+    {
+        p_copy = TUPLE_REALLOC(p_copy, 0);
+        return (void *) 0;
+    }
+
+    // Share every other child
+    for (size_t i = 0; i < TUPLE_NODE_WIDTH; i++)
+        if ( i != slot && p_copy->_p_slots[i] ) atomic_fetch_add_explicit(&((struct tuple_node_s *) p_copy->_p_slots[i])->references, 1, memory_order_relaxed);
+
+    // Success
+    return p_copy;
+}
+
+/** !
+ * Copy count elements under a node into a contiguous array
+ * 
+ * @param p_node     the node
+ * @param shift      index bits below the node
+ * @param p_elements the array
+ * @param count      quantity of elements under the node
+ * 
+ * @return void
+ */
+static void tuple_node_flatten ( const struct tuple_node_s *p_node, unsigned int shift, void **p_elements, size_t count )
+{
+
+    // Initialized data
+    size_t step = (size_t) 1 << shift;
+
+    // A leaf copies its elements
+    if ( shift == 0 )
+    {
+        memcpy(p_elements, p_node->_p_slots, count * sizeof(void *));
+        return;
+    }
+
+    // A branch copies each child's
+    for (size_t i = 0; i * step < count; i++)
+        tuple_node_flatten(p_node->_p_slots[i], shift - TUPLE_NODE_BITS, &p_elements[i * step], ( count - i * step < step ) ? count - i * step : step);
+
+    // Done
+    return;
+}
+
+/** !
+ * Get a tuple's elements as one contiguous array. Flat tuples already are one. A persistent
+ * tuple is flattened the first time, and keeps the copy until it is freed
+ * 
+ * @param p_tuple the tuple
+ * 
+ * @return the elements on success, null pointer on error
+ */
+static void **tuple_elements ( const tuple *p_tuple )
+{
+
+    // Flat tuples
+    if ( TUPLE_LIKELY(( p_tuple->_flags & TUPLE_FLAG_TREE ) == 0) ) return TUPLE_ARRAY(p_tuple);
+
+    // Initialized data
+    struct tuple_tree_s  *p_tree     = TUPLE_TREE(p_tuple);
+    void                **p_flat     = atomic_load_explicit(&p_tree->p_flat, memory_order_acquire),
+                        **p_expected = (void *) 0;
+
+    // Fast exit
+    if ( p_flat ) return p_flat;
+
+    // Allocate the copy
+    p_flat = TUPLE_REALLOC(0, p_tuple->element_count * sizeof(void *));
+
+    // Error check
+    if ( p_flat == (void *) 0 ) return (void *) 0;
+
+    // Fill it
+    tuple_node_flatten(p_tree->p_root, p_tree->shift, p_flat, p_tuple->element_count);
+
+    // Publish it, unless another thread got there first
+    if ( atomic_compare_exchange_strong_explicit(&p_tree->p_flat, &p_expected, p_flat, memory_order_acq_rel, memory_order_acquire) ) return p_flat;
+
+    // Use theirs
+    p_flat = TUPLE_REALLOC(p_flat, 0);
+
+    // Success
+    return p_expected;
+}
+
+/** !
+ * Get one element of a tuple. Persistent tuples walk their tree, and are not flattened
+ * 
+ * @param p_tuple the tuple
+ * @param offset  the element's offset, in bounds
+ * 
+ * @return the element
+ */
+static void *tuple_element ( const tuple *p_tuple, size_t offset )
+{
+
+    // Flat tuples
+    if ( TUPLE_LIKELY(( p_tuple->_flags & TUPLE_FLAG_TREE ) == 0) ) return TUPLE_ARRAY(p_tuple)[offset];
+
+    // Initialized data
+    const struct tuple_tree_s *p_tree = TUPLE_TREE(p_tuple);
+    const struct tuple_node_s *p_node = p_tree->p_root;
+
+    // Walk down to the leaf
+    for (unsigned int shift = p_tree->shift; shift; shift -= TUPLE_NODE_BITS)
+        p_node = p_node->_p_slots[( offset >> shift ) & TUPLE_NODE_MASK];
+
+    // Success
+    return p_node->_p_slots[offset & TUPLE_NODE_MASK];
+}
+
+/** !
+ * Replace offsets into a tuple with the elements at those offsets
+ * 
+ * @param p_tuple  the tuple
+ * @param p_values count offsets, each stored as a pointer sized integer, and in bounds
+ * @param count    quantity of offsets
+ * 
+ * @return void
+ */
+static void tuple_gather ( const tuple *p_tuple, void **p_values, size_t count )
+{
+
+    // Initialized data
+    void *const *p_elements = ( p_tuple->_flags & TUPLE_FLAG_TREE ) ? (void *) 0 : TUPLE_ARRAY(p_tuple);
+    size_t       i          = 0;
+
+    // Walk the tree for each element of a persistent tuple
+    if ( p_elements == (void *) 0 )
+    {
+        for (; i < count; i++) p_values[i] = tuple_element(p_tuple, (uintptr_t) p_values[i]);
+
+        // Done
+        return;
+    }
+
+    #if defined(TUPLE_SIMD_AVX2)
+
+        // Gather four elements at a time
+        for (; i + 4 <= count; i += 4)
+            _mm256_storeu_si256((__m256i *) &p_values[i], _mm256_i64gather_epi64((const long long *) p_elements, _mm256_loadu_si256((const __m256i *) &p_values[i]), sizeof(void *)));
+    #endif
+
+    // Gather what is left
+    for (; i < count; i++) p_values[i] = p_elements[(uintptr_t) p_values[i]];
+
+    // Done
+    return;
+}
+
+/** !
+ * Release the memory of a tuple to wherever it came from
+ * 
+ * @param p_tuple the tuple
+ * 
+ * @return void
+ */
+static void tuple_deallocate ( tuple *p_tuple )
+{
+
+    // Adopted elements go first, wherever the header came from
+    if ( p_tuple->_flags & TUPLE_FLAG_OWNER ) p_tuple->_elements[0] = TUPLE_REALLOC(p_tuple->_elements[0], 0);
+
+    // Persistent tuples give up their tree, and their flat copy. The header is on the heap
+    if ( p_tuple->_flags & TUPLE_FLAG_TREE )
+    {
+
+        // Initialized data
+        struct tuple_tree_s *p_tree = TUPLE_TREE(p_tuple);
+        void               **p_flat = atomic_load_explicit(&p_tree->p_flat, memory_order_acquire);
+
+        // Release the nodes
+        tuple_node_release(p_tree->p_root, p_tree->shift);
+
+        // Free the copy
+        if ( p_flat ) p_flat = TUPLE_REALLOC(p_flat, 0);
+    }
+
+    // Arena tuples are released all at once by tuple_arena_reset, batch tuples by
+    // tuple_destroy_batch, and inline tuples by their owner
+    if ( p_tuple->_flags & ( TUPLE_FLAG_ARENA | TUPLE_FLAG_BATCH | TUPLE_FLAG_INLINE ) ) return;
+
+    // Pool tuples
+    if ( p_tuple->_flags & TUPLE_FLAG_POOL ) tuple_pool_deallocate(p_tuple);
+
+    // Heap tuples
+    else p_tuple = TUPLE_REALLOC(p_tuple, 0);
+
+    // Done
+    return;
+}
+
+/** !
+ * Give up one reference to a tuple, and release its memory if that was the last one
+ * 
+ * @param p_tuple the tuple
+ * 
+ * @return void
+ */
+static void tuple_unreference ( tuple *p_tuple )
+{
+
+    // A sole owner can't race with anyone, so skip the read-modify-write. The load acquires, so
+    // an owner that just let go from 2 to 1 is done with the tuple before it is freed
+    if ( atomic_load_explicit(&p_tuple->_references, memory_order_acquire) == 1 ) goto last_reference;
+
+    // Give up a reference, publishing this thread's reads and writes of the tuple
+    if ( atomic_fetch_sub_explicit(&p_tuple->_references, 1, memory_order_release) != 1 ) return;
+
+    // See every other owner's reads and writes before freeing
+    atomic_thread_fence(memory_order_acquire);
+
+    last_reference:
+
+    // Free the tuple
+    tuple_deallocate(p_tuple);
+
+    // Done
+    return;
+}
+
+// Function declarations
+tuple_status tuple_last_status ( void )
+{
+
+    // Success
+    return tuple_status_value;
+}
+
+void tuple_clear_status ( void )
+{
+
+    // Clear
+    tuple_status_value = TUPLE_STATUS_OK;
+
+    // Done
+    return;
+}
+
+const char *tuple_status_string ( tuple_status status )
+{
+
+    // Strategy
+    switch ( status )
+    {
+        case TUPLE_STATUS_OK:                return "no error";
+        case TUPLE_STATUS_NO_TUPLE:          return "null pointer provided for a tuple";
+        case TUPLE_STATUS_NO_ELEMENTS:       return "no elements provided";
+        case TUPLE_STATUS_NO_VALUE:          return "null pointer provided for a return parameter";
+        case TUPLE_STATUS_NO_FUNCTION:       return "null pointer provided for a function";
+        case TUPLE_STATUS_NO_STORAGE:        return "null pointer provided for storage";
+        case TUPLE_STATUS_NO_VIEW:           return "null pointer provided for a view";
+        case TUPLE_STATUS_NO_POOL:           return "null pointer provided for a pool";
+        case TUPLE_STATUS_NO_ARENA:          return "null pointer provided for an arena";
+        case TUPLE_STATUS_EMPTY:             return "empty tuple";
+        case TUPLE_STATUS_BOUNDS_ERROR:      return "index out of bounds";
+        case TUPLE_STATUS_LOWER_BOUND:       return "lower bound out of bounds";
+        case TUPLE_STATUS_UPPER_BOUND:       return "upper bound out of bounds";
+        case TUPLE_STATUS_TOO_MANY_ELEMENTS: return "too many elements";
+        case TUPLE_STATUS_NO_MEM:            return "failed to allocate memory";
+        case TUPLE_STATUS_SYNC_ERROR:        return "sync error";
+        case TUPLE_STATUS_NOT_READING:       return "not in a read section";
+        case TUPLE_STATUS_NO_TABLE:          return "null pointer provided for a table";
+        case TUPLE_STATUS_NO_ROW:            return "null pointer provided for a row";
+        case TUPLE_STATUS_ARITY_MISMATCH:    return "tuple size does not match table arity";
+        case TUPLE_STATUS_NO_BUILDER:        return "null pointer provided for a builder";
+        case TUPLE_STATUS_READ_ONLY:         return "tuple can not be updated in place";
+        case TUPLE_STATUS_BAD_ORDER:         return "memory order not valid for the operation";
+        case TUPLE_STATUS_NO_PIPELINE:       return "null pointer provided for a pipeline";
+        case TUPLE_STATUS_NO_KEYS:           return "no keys provided for a sort or a join";
+        case TUPLE_STATUS_BAD_JOIN:          return "join mode not valid";
+    }
+
+    // Default
+    return "unknown status";
+}
+
+void tuple_log_limit ( size_t limit )
+{
+
+    // Set the limit
+    atomic_store_explicit(&tuple_log_max, limit, memory_order_relaxed);
+
+    // Done
+    return;
+}
+
+void tuple_report ( tuple_status status, const char *const format, ... )
+{
+
+    // Uninitialized data
+    va_list list;
+
+    // Record the status
+    tuple_status_value = status;
+
+    // Fast exit
+    if ( TUPLE_LIKELY(atomic_load_explicit(&tuple_log_max, memory_order_relaxed) == 0) ) return;
+
+    // Log
+    va_start(list, format);
+    tuple_log_v(format, list);
+    va_end(list);
+
+    // Done
+    return;
+}
+
+int tuple_create ( tuple **const pp_tuple )
+{
+
+    // Argument check
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+
+    // Allocate memory for a tuple
+    tuple *p_tuple = tuple_allocate(0);
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Return the allocated memory
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_pool_create ( tuple_pool **const pp_pool )
+{
+
+    // Argument check
+    if ( pp_pool == (void *) 0 ) goto no_pool;
+
+    // Allocate memory for a pool
+    tuple_pool *p_pool = TUPLE_REALLOC(0, sizeof(tuple_pool));
+
+    // Error checking
+    if ( p_pool == (void *) 0 ) goto no_mem;
+
+    // Zero set
+    memset(p_pool, 0, sizeof(tuple_pool));
+
+    // Construct a lock
+    if ( mutex_create(&p_pool->_lock) == 0 ) goto failed_to_create_mutex;
+
+    // Start at generation zero
+    atomic_init(&p_pool->generation, 0);
+
+    // Return the allocated memory
+    *pp_pool = p_pool;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pool:
+                TUPLE_ERROR(TUPLE_STATUS_NO_POOL, "[tuple] Null pointer provided for parameter \"pp_pool\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // sync errors
+        {
+            failed_to_create_mutex:
+                TUPLE_ERROR(TUPLE_STATUS_SYNC_ERROR, "[tuple] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+
+                // Clean up
+                p_pool = TUPLE_REALLOC(p_pool, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_arena_create ( tuple_arena **const pp_arena )
+{
+
+    // Argument check
+    if ( pp_arena == (void *) 0 ) goto no_arena;
+
+    // Allocate memory for an arena
+    tuple_arena *p_arena = TUPLE_REALLOC(0, sizeof(tuple_arena));
+
+    // Error checking
+    if ( p_arena == (void *) 0 ) goto no_mem;
+
+    // Zero set
+    memset(p_arena, 0, sizeof(tuple_arena));
+
+    // Return the allocated memory
+    *pp_arena = p_arena;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ARENA, "[tuple] Null pointer provided for parameter \"pp_arena\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_intern_table_create ( tuple_intern_table **const pp_table, unsigned long long (*const pfn_element_hash)(const void *const value), int (*const pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Argument check
+    if ( pp_table == (void *) 0 ) goto no_table;
+    if ( ( pfn_element_hash == (void *) 0 ) != ( pfn_compare == (void *) 0 ) ) goto no_func;
+
+    // Allocate memory for a table
+    tuple_intern_table *p_table = TUPLE_REALLOC(0, sizeof(tuple_intern_table));
+
+    // Error checking
+    if ( p_table == (void *) 0 ) goto no_mem;
+
+    // Zero set
+    memset(p_table, 0, sizeof(tuple_intern_table));
+
+    // Store the callbacks
+    p_table->pfn_element_hash = pfn_element_hash;
+    p_table->pfn_compare      = pfn_compare;
+
+    // Construct each stripe's lock
+    for (size_t i = 0; i < TUPLE_INTERN_STRIPES; i++)
+        if ( mutex_create(&p_table->_stripes[i]._lock) == 0 ) goto failed_to_create_mutex;
+
+    // Return the allocated memory
+    *pp_table = p_table;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"pp_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_func:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Parameters \"pfn_element_hash\" and \"pfn_compare\" must both be null, or both be set, in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // sync errors
+        {
+            failed_to_create_mutex:
+                TUPLE_ERROR(TUPLE_STATUS_SYNC_ERROR, "[tuple] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+
+                // Clean up
+                p_table = TUPLE_REALLOC(p_table, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_table_create ( tuple_table **const pp_table, size_t arity )
+{
+
+    // Argument check
+    if ( pp_table == (void *) 0 ) goto no_table;
+
+    // Allocate memory for a table
+    tuple_table *p_table = TUPLE_REALLOC(0, sizeof(tuple_table));
+
+    // Error checking
+    if ( p_table == (void *) 0 ) goto no_mem;
+
+    // Populate the table. Columns are allocated by the first append
+    *p_table = (tuple_table)
+    {
+        .arity    = arity,
+        .rows     = 0,
+        .capacity = 0,
+        ._p_data  = (void *) 0
+    };
+
+    // Return the allocated memory
+    *pp_table = p_table;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"pp_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_builder_create ( tuple_builder **const pp_builder, size_t capacity )
+{
+
+    // Argument check
+    if ( pp_builder == (void *) 0 ) goto no_builder;
+
+    // Overflow check
+    if ( capacity > ( ( (size_t) -1 - sizeof(tuple) ) / sizeof(void *) ) ) goto no_mem;
+
+    // Initialized data
+    tuple_builder *p_builder = TUPLE_REALLOC(0, sizeof(tuple_builder));
+    tuple         *p_tuple   = (void *) 0;
+
+    // Error checking
+    if ( p_builder == (void *) 0 ) goto no_mem;
+
+    // Allocate the buffer
+    p_tuple = TUPLE_REALLOC(0, sizeof(tuple) + capacity * sizeof(void *));
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto failed_to_allocate_buffer;
+
+    // Nothing pushed yet
+    p_tuple->element_count = 0;
+
+    // Populate the builder
+    *p_builder = (tuple_builder)
+    {
+        .capacity = capacity,
+        .p_tuple  = p_tuple
+    };
+
+    // Return the allocated memory
+    *pp_builder = p_builder;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_builder:
+                TUPLE_ERROR(TUPLE_STATUS_NO_BUILDER, "[tuple] Null pointer provided for parameter \"pp_builder\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_allocate_buffer:
+
+                // Free the builder
+                p_builder = TUPLE_REALLOC(p_builder, 0);
+
+                // Fall through
+
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_pipeline_create ( tuple_pipeline **const pp_pipeline, tuple *const p_source )
+{
+
+    // Argument check
+    if ( pp_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( p_source    == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    tuple_pipeline       *p_pipeline = TUPLE_REALLOC(0, sizeof(tuple_pipeline));
+    struct tuple_stage_s *p_stages   = (void *) 0;
+
+    // Error checking
+    if ( p_pipeline == (void *) 0 ) goto no_mem;
+
+    // Allocate the stages
+    p_stages = TUPLE_REALLOC(0, TUPLE_PIPELINE_STAGES * sizeof(struct tuple_stage_s));
+
+    // Error checking
+    if ( p_stages == (void *) 0 ) goto failed_to_allocate_stages;
+
+    // Keep the source alive for as long as the pipeline
+    tuple_retain(p_source);
+
+    // Populate the pipeline
+    *p_pipeline = (tuple_pipeline)
+    {
+        .p_source  = p_source,
+        .count     = 0,
+        .capacity  = TUPLE_PIPELINE_STAGES,
+        ._p_stages = p_stages
+    };
+
+    // Return the allocated memory
+    *pp_pipeline = p_pipeline;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                TUPLE_ERROR(TUPLE_STATUS_NO_PIPELINE, "[tuple] Null pointer provided for parameter \"pp_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_source\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_allocate_stages:
+
+                // Free the pipeline
+                p_pipeline = TUPLE_REALLOC(p_pipeline, 0);
+
+                // Fall through
+
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_construct ( tuple **const pp_tuple, size_t size )
+{
+
+    // Argument check
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    tuple *p_tuple = tuple_allocate(size);
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Zero set the elements
+    memset(p_tuple->_elements, 0, size * sizeof(void *));
+
+    // Return a pointer to the caller
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;                
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_from_elements ( tuple **const pp_tuple, void *const *const elements, size_t size )
+{
+
+    // Argument check
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+    if ( elements == (void *) 0 ) goto no_elements;
+
+    // Initialized data
+    tuple *p_tuple = tuple_allocate(size);
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Copy the elements into the tuple
+    memcpy(p_tuple->_elements, elements, size * sizeof(void *));
+
+    // Return
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"keys\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_from_elements_batch ( tuple ***const ppp_tuples, void *const *const elements, const size_t *const sizes, size_t count )
+{
+
+    // Argument check
+    if ( ppp_tuples == (void *) 0 ) goto no_tuple;
+    if ( elements   == (void *) 0 ) goto no_elements;
+    if ( sizes      == (void *) 0 ) goto no_elements;
+
+    // Initialized data
+    struct tuple_batch_s *p_batch   = (void *) 0;
+    unsigned char        *p_cursor  = (void *) 0;
+    void *const          *p_element = elements;
+    size_t                total     = 0,
+                          bytes     = 0;
+
+    // Count every element
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Overflow check
+        if ( sizes[i] > (size_t) -1 - total ) goto no_mem;
+
+        // Accumulate
+        total += sizes[i];
+    }
+
+    // Overflow check
+    if ( count > ( (size_t) -1 / 2 ) / ( sizeof(tuple *) + sizeof(tuple) ) ) goto no_mem;
+    if ( total > ( (size_t) -1 / 2 ) / sizeof(void *) ) goto no_mem;
+
+    // One block for the handles, every header, and every element
+    bytes   = sizeof(struct tuple_batch_s) + count * ( sizeof(tuple *) + sizeof(tuple) ) + total * sizeof(void *);
+    p_batch = TUPLE_REALLOC(0, bytes);
+
+    // Error check
+    if ( p_batch == (void *) 0 ) goto no_mem;
+
+    // Store the quantity of tuples
+    p_batch->count = count;
+
+    // The tuples start after the handles
+    p_cursor = (unsigned char *) &p_batch->_p_tuples[count];
+
+    // Lay out each tuple back to back
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Initialized data
+        tuple *p_tuple = (tuple *) p_cursor;
+
+        // Set the header
+        p_tuple->element_count = sizes[i];
+        p_tuple->_flags        = TUPLE_FLAG_BATCH;
+        atomic_init(&p_tuple->_references, 1);
+
+        // Copy the elements
+        memcpy(p_tuple->_elements, p_element, sizes[i] * sizeof(void *));
+
+        // Store the handle
+        p_batch->_p_tuples[i] = p_tuple;
+
+        // Advance
+        p_element += sizes[i];
+        p_cursor  += sizeof(tuple) + sizes[i] * sizeof(void *);
+    }
+
+    // Return the handles
+    *ppp_tuples = p_batch->_p_tuples;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"ppp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"elements\" or \"sizes\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_adopt ( tuple **const pp_tuple, void **const elements, size_t size )
+{
+
+    // Argument check
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+    if ( elements == (void *) 0 ) goto no_elements;
+
+    // Initialized data
+    tuple_arena *p_arena = p_tuple_arena;
+    tuple       *p_tuple = (void *) 0;
+
+    // An arena releases its tuples without visiting them, which would leak the elements, so
+    // the header comes from the pool or the heap
+    p_tuple_arena = (void *) 0;
+    p_tuple       = tuple_allocate(1);
+    p_tuple_arena = p_arena;
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Point the tuple at the caller's array from its one slot, and take ownership of it
+    p_tuple->element_count  = size;
+    p_tuple->_elements[0]   = elements;
+    p_tuple->_flags        |= TUPLE_FLAG_OWNER;
+
+    // Return
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_borrow ( tuple **const pp_tuple, void *const *const elements, size_t size )
+{
+
+    // Argument check
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+    if ( elements == (void *) 0 ) goto no_elements;
+
+    // Initialized data
+    tuple *p_tuple = tuple_allocate(1);
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Point the tuple at the caller's array from its one slot. Atomic updates refuse borrowed
+    // tuples, so the array's constness is kept
+    p_tuple->element_count  = size;
+    p_tuple->_elements[0]   = (void *) elements;
+    p_tuple->_flags        |= TUPLE_FLAG_BORROWED;
+
+    // Return
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_with ( const tuple *const p_tuple, signed long long index, void *const value, tuple **const pp_result )
+{
+
+    // Argument check
+    if ( p_tuple   == (void *) 0 ) goto no_tuple;
+    if ( pp_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    size_t               offset     = 0,
+                         size       = p_tuple->element_count;
+    unsigned int         shift      = 0;
+    void *const         *p_elements = (void *) 0;
+    struct tuple_node_s *p_root     = (void *) 0,
+                        *p_node     = (void *) 0;
+    tuple               *p_result   = (void *) 0;
+
+    // Bounds check
+    if ( tuple_offset(index, size, &offset) == 0 ) goto bounds_error;
+
+    // Narrow tuples are copied
+    if ( size < TUPLE_PERSISTENT_MIN )
+    {
+
+        // Allocate a tuple
+        p_result = tuple_allocate(size);
+
+        // Error check
+        if ( p_result == (void *) 0 ) goto no_mem;
+
+        // Copy the elements, and change one
+        memcpy(p_result->_elements, TUPLE_ARRAY(p_tuple), size * sizeof(void *));
+        p_result->_elements[offset] = value;
+
+        // Done
+        goto done;
+    }
+
+    // A persistent tuple copies the path to the element, and shares every other node ...
+    if ( p_tuple->_flags & TUPLE_FLAG_TREE )
+    {
+
+        // Same depth as the original
+        shift = TUPLE_TREE(p_tuple)->shift;
+
+        // Copy the path
+        p_root = tuple_node_with(TUPLE_TREE(p_tuple)->p_root, shift, offset, value);
+
+        // Error check
+        if ( p_root == (void *) 0 ) goto no_mem;
+    }
+
+    // ... and a wide flat tuple is split into a tree first
+    else
+    {
+
+        // Initialized data
+        p_elements = tuple_elements(p_tuple);
+
+        // Deep enough for every element
+        while ( ( (size_t) TUPLE_NODE_WIDTH << shift ) < size ) shift += TUPLE_NODE_BITS;
+
+        // Build the tree
+        p_root = tuple_node_build(p_elements, size, shift);
+
+        // Error check
+        if ( p_root == (void *) 0 ) goto no_mem;
+
+        // Nothing shares the new nodes, so the element is changed in place
+        p_node = p_root;
+        for (unsigned int s = shift; s; s -= TUPLE_NODE_BITS)
+            p_node = p_node->_p_slots[( offset >> s ) & TUPLE_NODE_MASK];
+        p_node->_p_slots[offset & TUPLE_NODE_MASK] = value;
+    }
+
+    // Allocate the header, and the tree after it, on the heap
+    p_result = TUPLE_REALLOC(0, sizeof(tuple) + ( TUPLE_HASH_SLOTS * sizeof(void *) ) + sizeof(struct tuple_tree_s));
+
+    // Error check
+    if ( p_result == (void *) 0 ) goto failed_to_allocate_tuple;
+
+    // Set the header. Persistent tuples have no flat elements until one is needed
+    p_result->element_count = size;
+    p_result->_flags        = TUPLE_FLAG_TREE | TUPLE_FLAG_HASH;
+    atomic_init(&p_result->_references, 1);
+    atomic_init(tuple_hash_slot(p_result), TUPLE_HASH_NONE);
+
+    // Store the tree
+    TUPLE_TREE(p_result)->p_root = p_root;
+    TUPLE_TREE(p_result)->shift  = shift;
+    atomic_init(&TUPLE_TREE(p_result)->p_flat, (void *) 0);
+
+    done:
+
+    // Return the tuple
+    *pp_result = p_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_allocate_tuple:
+
+                // Release the tree
+                tuple_node_release(p_root, shift);
+
+                // Fall through
+
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_concat ( const tuple *const *const pp_tuples, size_t count, tuple **const pp_result )
+{
+
+    // Argument check
+    if ( pp_tuples == (void *) 0 ) goto no_elements;
+    if ( pp_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    tuple  *p_result = (void *) 0;
+    size_t  size     = 0,
+            offset   = 0;
+
+    // Add up the sizes
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Argument check
+        if ( pp_tuples[i] == (void *) 0 ) goto no_tuple;
+
+        // Overflow check
+        if ( pp_tuples[i]->element_count > (size_t) -1 - size ) goto no_mem;
+
+        // Accumulate
+        size += pp_tuples[i]->element_count;
+    }
+
+    // Allocate the result once
+    p_result = tuple_allocate(size);
+
+    // Error check
+    if ( p_result == (void *) 0 ) goto no_mem;
+
+    // Copy each tuple's elements straight into the result
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Initialized data
+        void *const *p_elements = tuple_elements(pp_tuples[i]);
+
+        // Error check
+        if ( p_elements == (void *) 0 ) goto failed_to_flatten;
+
+        // Copy
+        memcpy(&p_result->_elements[offset], p_elements, pp_tuples[i]->element_count * sizeof(void *));
+
+        // Advance
+        offset += pp_tuples[i]->element_count;
+    }
+
+    // Return the tuple
+    *pp_result = p_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null tuple in parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_flatten:
+
+                // Free the result
+                tuple_deallocate(p_result);
+
+                // Fall through
+
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_project ( const tuple *const p_tuple, const signed long long *const indices, size_t count, tuple **const pp_result )
+{
+
+    // Argument check
+    if ( p_tuple   == (void *) 0 ) goto no_tuple;
+    if ( indices   == (void *) 0 && count ) goto no_elements;
+    if ( pp_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    tuple *p_result = tuple_allocate(count);
+
+    // Error check
+    if ( p_result == (void *) 0 ) goto no_mem;
+
+    // Turn the indices into offsets, in the result, and check them all at once
+    if ( tuple_offsets(indices, count, p_tuple->element_count, p_result->_elements) == 0 ) goto bounds_error;
+
+    // Replace each offset with its element
+    tuple_gather(p_tuple, p_result->_elements, count);
+
+    // Return the tuple
+    *pp_result = p_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"indices\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+
+                // Free the result
+                tuple_deallocate(p_result);
+
+                // Report
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_project_batch ( const tuple *const *const pp_tuples, size_t tuple_count, const signed long long *const indices, size_t count, tuple ***const ppp_results )
+{
+
+    // Argument check
+    if ( pp_tuples   == (void *) 0 ) goto no_elements;
+    if ( indices     == (void *) 0 && count ) goto no_elements;
+    if ( ppp_results == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    struct tuple_batch_s *p_batch  = (void *) 0;
+    unsigned char        *p_cursor = (void *) 0;
+
+    // Argument check
+    for (size_t i = 0; i < tuple_count; i++) if ( pp_tuples[i] == (void *) 0 ) goto no_tuple;
+
+    // Overflow check
+    if ( count > ( (size_t) -1 / 4 ) / sizeof(void *) ) goto no_mem;
+    if ( tuple_count > ( (size_t) -1 / 4 ) / ( sizeof(tuple *) + sizeof(tuple) + count * sizeof(void *) ) ) goto no_mem;
+
+    // One block for the handles, every header, and every element, like tuple_from_elements_batch
+    p_batch = TUPLE_REALLOC(0, sizeof(struct tuple_batch_s) + tuple_count * ( sizeof(tuple *) + sizeof(tuple) + count * sizeof(void *) ));
+
+    // Error check
+    if ( p_batch == (void *) 0 ) goto no_mem;
+
+    // Store the quantity of tuples
+    p_batch->count = tuple_count;
+
+    // The tuples start after the handles
+    p_cursor = (unsigned char *) &p_batch->_p_tuples[tuple_count];
+
+    // Project each tuple
+    for (size_t i = 0; i < tuple_count; i++)
+    {
+
+        // Initialized data
+        tuple *p_tuple = (tuple *) p_cursor;
+
+        // Set the header
+        p_tuple->element_count = count;
+        p_tuple->_flags        = TUPLE_FLAG_BATCH;
+        atomic_init(&p_tuple->_references, 1);
+
+        // Sources may differ in size, so each one checks the indices
+        if ( tuple_offsets(indices, count, pp_tuples[i]->element_count, p_tuple->_elements) == 0 ) goto bounds_error;
+
+        // Replace each offset with its element
+        tuple_gather(pp_tuples[i], p_tuple->_elements, count);
+
+        // Store the handle
+        p_batch->_p_tuples[i] = p_tuple;
+
+        // Advance
+        p_cursor += sizeof(tuple) + count * sizeof(void *);
+    }
+
+    // Return the handles
+    *ppp_results = p_batch->_p_tuples;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"pp_tuples\" or \"indices\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null tuple in parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"ppp_results\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+
+                // Free the block
+                p_batch = TUPLE_REALLOC(p_batch, 0);
+
+                // Report
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_zip ( const tuple *const *const pp_tuples, size_t count, tuple **const pp_result )
+{
+
+    // Argument check
+    if ( pp_tuples == (void *) 0 ) goto no_elements;
+    if ( pp_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    tuple  *p_result = (void *) 0;
+    size_t  rows     = ( count ) ? (size_t) -1 : 0;
+
+    // The shortest tuple decides the quantity of rows
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Argument check
+        if ( pp_tuples[i] == (void *) 0 ) goto no_tuple;
+
+        // Shortest so far
+        if ( pp_tuples[i]->element_count < rows ) rows = pp_tuples[i]->element_count;
+    }
+
+    // Overflow check
+    if ( count && rows > (size_t) -1 / count ) goto no_mem;
+
+    // Allocate the result once
+    p_result = tuple_allocate(rows * count);
+
+    // Error check
+    if ( p_result == (void *) 0 ) goto no_mem;
+
+    // Copy each tuple's elements into every count'th slot, starting at its own column
+    for (size_t k = 0; k < count; k++)
+    {
+
+        // Initialized data
+        void *const *p_elements = tuple_elements(pp_tuples[k]);
+        void       **p_column   = &p_result->_elements[k];
+
+        // Error check
+        if ( p_elements == (void *) 0 ) goto failed_to_flatten;
+
+        // Copy
+        for (size_t i = 0; i < rows; i++) p_column[i * count] = p_elements[i];
+    }
+
+    // Return the tuple
+    *pp_result = p_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null tuple in parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_flatten:
+
+                // Free the result
+                tuple_deallocate(p_result);
+
+                // Fall through
+
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_from_arguments ( tuple **const pp_tuple, size_t element_count, ... )
+{
+
+    // Argument check
+    if ( pp_tuple      == (void *) 0 ) goto no_tuple;
+    if ( element_count ==          0 ) goto no_elements;
+
+    // Uninitialized data
+    va_list list;
+
+    // Initialized data
+    tuple *p_tuple = 0;
+
+    // Allocate a tuple
+    p_tuple = tuple_allocate(element_count);
+
+    // Error checking
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Initialize the variadic list
+    va_start(list, element_count);
+
+    // Iterate over each key
+    for (size_t i = 0; i < element_count; i++)
+
+        // Add the key to the tuple
+        p_tuple->_elements[i] = va_arg(list, void *);
+    
+    // End the variadic list
+    va_end(list);
+
+    // Return
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Parameter \"element_count\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_init_inline ( tuple **const pp_tuple, tuple_inline *const p_storage, size_t element_count, ... )
+{
+
+    // Argument check
+    if ( pp_tuple      ==      (void *) 0       ) goto no_tuple;
+    if ( p_storage     ==      (void *) 0       ) goto no_storage;
+    if ( element_count >  TUPLE_INLINE_CAPACITY ) goto too_many_elements;
+
+    // Uninitialized data
+    va_list list;
+
+    // Initialized data
+    tuple *p_tuple = (tuple *) p_storage;
+
+    // Set the header
+    p_tuple->element_count = element_count;
+    p_tuple->_flags        = TUPLE_FLAG_INLINE;
+    atomic_init(&p_tuple->_references, 1);
+
+    // Initialize the variadic list
+    va_start(list, element_count);
+
+    // Iterate over each element
+    for (size_t i = 0; i < element_count; i++)
+
+        // Add the element to the tuple
+        p_tuple->_elements[i] = va_arg(list, void *);
+
+    // End the variadic list
+    va_end(list);
+
+    // Return
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_storage:
+                TUPLE_ERROR(TUPLE_STATUS_NO_STORAGE, "[tuple] Null pointer provided for parameter \"p_storage\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            too_many_elements:
+                TUPLE_ERROR(TUPLE_STATUS_TOO_MANY_ELEMENTS, "[tuple] Parameter \"element_count\" must be less than or equal to TUPLE_INLINE_CAPACITY in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+    }
+}
+
+int tuple_index ( const tuple *const p_tuple, signed long long index, void **const pp_value )
+{
+
+    // Argument check
+    if ( p_tuple                == (void *) 0 ) goto no_tuple;
+    if ( p_tuple->element_count ==          0 ) goto no_elements;
+    if ( pp_value               == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    size_t offset = 0;
+
+    // Error check
+    if ( tuple_offset(index, p_tuple->element_count, &offset) == 0 ) goto bounds_error;
+
+    // Return the element
+    *pp_value = tuple_element(p_tuple, offset);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        no_tuple:
+            TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+            // Error
+            return 0;
+
+        no_value:
+            TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_vale\" in call to function \"%s\"\n", __FUNCTION__);
+
+            // Error
+            return 0;
+
+        no_elements:
+            TUPLE_ERROR(TUPLE_STATUS_EMPTY, "[tuple] Can not index an empty tuple in call to function \"%s\"\n", __FUNCTION__);
+
+            // Error 
+            return 0;
+        
+        bounds_error:
+            TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+            // Error
+            return 0;
+    }
+}
+
+int tuple_index_many ( const tuple *const p_tuple, const signed long long *const indices, size_t count, void **const pp_values )
+{
+
+    // Argument check
+    if ( p_tuple   == (void *) 0 ) goto no_tuple;
+    if ( count     ==          0 ) return 1;
+    if ( indices   == (void *) 0 ) goto no_elements;
+    if ( pp_values == (void *) 0 ) goto no_value;
+    if ( p_tuple->element_count == 0 ) goto empty;
+
+    // Turn the indices into offsets, in the caller's array, and check them all at once
+    if ( tuple_offsets(indices, count, p_tuple->element_count, pp_values) == 0 ) goto bounds_error;
+
+    // Replace each offset with its element
+    tuple_gather(p_tuple, pp_values, count);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"indices\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_values\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            empty:
+                TUPLE_ERROR(TUPLE_STATUS_EMPTY, "[tuple] Can not index an empty tuple in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_slice ( const tuple *const p_tuple, const void **const pp_elements, signed long long lower_bound, signed long long  upper_bound )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( pp_elements == 0 ) goto no_pp_elements;
+    if ( lower_bound < 0 ) goto erroneous_lower_bound;
+    if ( upper_bound < lower_bound || (size_t) upper_bound >= p_tuple->element_count ) goto erroneous_upper_bound;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Return the elements
+    memcpy(pp_elements, &p_elements[lower_bound], sizeof(void *) * (size_t) ( upper_bound - lower_bound + 1 ) );
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            erroneous_lower_bound:
+                TUPLE_ERROR(TUPLE_STATUS_LOWER_BOUND, "[tuple] Parameter \"lower_bound\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+                
+            erroneous_upper_bound:
+                TUPLE_ERROR(TUPLE_STATUS_UPPER_BOUND, "[tuple] Parameter \"upper_bound\" must be between \"lower_bound\" and the last element in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+
+            no_pp_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error 
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+const void *const *tuple_data ( const tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return (const void *const *) p_elements;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return (void *) 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+bool tuple_is_empty ( const tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+    // Success
+    return ( p_tuple->element_count == 0 );
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t tuple_size ( const tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+    // Success
+    return p_tuple->element_count;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_view_of ( const tuple *const p_tuple, tuple_view *const p_view )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( p_view  == (void *) 0 ) goto no_view;
+
+    // Borrow every element
+    *p_view = (tuple_view)
+    {
+        .p_tuple = p_tuple,
+        .offset  = 0,
+        .length  = p_tuple->element_count
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_view\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_view_slice ( const tuple_view *const p_view, tuple_view *const p_slice, signed long long lower_bound, signed long long upper_bound )
+{
+
+    // Argument check
+    if ( p_view  == (void *) 0 ) goto no_view;
+    if ( p_slice == (void *) 0 ) goto no_slice;
+
+    // Initialized data
+    size_t lower = 0,
+           upper = 0;
+
+    // Bounds check
+    if ( tuple_offset(lower_bound, p_view->length, &lower) == 0 ) goto erroneous_lower_bound;
+    if ( tuple_offset(upper_bound, p_view->length, &upper) == 0 ) goto erroneous_upper_bound;
+    if ( lower > upper ) goto erroneous_upper_bound;
+
+    // Narrow the window
+    *p_slice = (tuple_view)
+    {
+        .p_tuple = p_view->p_tuple,
+        .offset  = p_view->offset + lower,
+        .length  = upper - lower + 1
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_view\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_slice:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"p_slice\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            erroneous_lower_bound:
+                TUPLE_ERROR(TUPLE_STATUS_LOWER_BOUND, "[tuple] Parameter \"lower_bound\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            erroneous_upper_bound:
+                TUPLE_ERROR(TUPLE_STATUS_UPPER_BOUND, "[tuple] Parameter \"upper_bound\" must be in bounds and not less than \"lower_bound\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_view_index ( const tuple_view *const p_view, signed long long index, void **const pp_value )
+{
+
+    // Argument check
+    if ( p_view   == (void *) 0 ) goto no_view;
+    if ( pp_value == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    size_t offset = 0;
+
+    // Bounds check
+    if ( tuple_offset(index, p_view->length, &offset) == 0 ) goto bounds_error;
+
+    // Return the element
+    *pp_value = tuple_element(p_view->p_tuple, p_view->offset + offset);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_view\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+const void *const *tuple_view_data ( const tuple_view *const p_view )
+{
+
+    // Argument check
+    if ( p_view == (void *) 0 ) goto no_view;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_view->p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return (const void *const *) &p_elements[p_view->offset];
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_view\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return (void *) 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+int tuple_view_foreach ( const tuple_view *const p_view, void (*const pfn_function)(void *const value, size_t index) )
+{
+
+    // Argument check
+    if ( p_view       == (void *) 0 ) goto no_view;
+    if ( pfn_function == (void *) 0 ) goto no_func;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_view->p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Start at the view's first element
+    p_elements += p_view->offset;
+
+    // Iterate over each element in the view
+    for (size_t i = 0; i < p_view->length; i++)
+
+        // Call the function
+        pfn_function(p_elements[i], i);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_view\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_func:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_function\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_foreach ( const tuple *const p_tuple, void (*const pfn_function)(void *const value, size_t index) )
+{
+
+    // Argument check
+    if ( p_tuple      == (void *) 0 ) goto no_tuple;
+    if ( pfn_function == (void *) 0 ) goto no_func;
+
+    // Iterate over each element in the tuple. Persistent tuples are walked leaf by leaf
+    if ( p_tuple->_flags & TUPLE_FLAG_TREE )
+    {
+
+        // Initialized data
+        const struct tuple_tree_s *p_tree = TUPLE_TREE(p_tuple);
+
+        // Each leaf
+        for (size_t i = 0; i < p_tuple->element_count; i += TUPLE_NODE_WIDTH)
+        {
+
+            // Initialized data
+            const struct tuple_node_s *p_node = p_tree->p_root;
+            size_t                     end    = ( p_tuple->element_count - i < TUPLE_NODE_WIDTH ) ? p_tuple->element_count : i + TUPLE_NODE_WIDTH;
+
+            // Walk down to the leaf
+            for (unsigned int shift = p_tree->shift; shift; shift -= TUPLE_NODE_BITS)
+                p_node = p_node->_p_slots[( i >> shift ) & TUPLE_NODE_MASK];
+
+            // Call the function on its elements
+            for (size_t j = i; j < end; j++) pfn_function(p_node->_p_slots[j & TUPLE_NODE_MASK], j);
+        }
+    }
+
+    // Flat tuples
+    else
+        for (size_t i = 0; i < p_tuple->element_count; i++)
+
+            // Call the function
+            pfn_function(TUPLE_ARRAY(p_tuple)[i], i);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+            
+            no_func:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_function\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Process the elements in [ begin, end ) for a job
+ * 
+ * @param p_job   the job
+ * @param p_range the calling thread's range, which holds its partial reduction
+ * @param begin   first index
+ * @param end     one past the last index
+ * 
+ * @return void
+ */
+static void tuple_parallel_chunk ( struct tuple_parallel_job_s *p_job, struct tuple_parallel_range_s *p_range, size_t begin, size_t end )
+{
+
+    // Range jobs hand the whole chunk to their callback
+    if ( p_job->pfn_range )
+    {
+        p_job->pfn_range(p_job->p_context, begin, end);
+
+        // Done
+        return;
+    }
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_job->p_tuple);
+
+    // Call the function on each element ...
+    if ( p_job->pfn_function )
+        for (size_t i = begin; i < end; i++) p_job->pfn_function(p_elements[i], i);
+
+    // ... or fold each mapped element into the partial
+    else
+        for (size_t i = begin; i < end; i++) p_range->p_partial = p_job->pfn_reduce(p_range->p_partial, p_job->pfn_map(p_elements[i], i));
+
+    // Done
+    return;
+}
+
+/** !
+ * Take part in a job. Claim grain sized chunks from the front of this thread's range, and
+ * when it runs dry, steal the back half of another thread's range
+ * 
+ * @param p_job the job
+ * 
+ * @return void
+ */
+static void tuple_parallel_run ( struct tuple_parallel_job_s *p_job )
+{
+
+    // Initialized data
+    size_t                         self    = atomic_fetch_add_explicit(&p_job->next, 1, memory_order_relaxed);
+    struct tuple_parallel_range_s *p_range = &p_job->_ranges[self];
+
+    // More threads woke than the job was split for
+    if ( self >= p_job->threads ) return;
+
+    // Until every range is empty
+    for (;;)
+    {
+
+        // Initialized data
+        size_t begin = 0,
+               end   = 0;
+
+        // Claim a chunk from the front of this thread's range
+        while ( atomic_flag_test_and_set_explicit(&p_range->_lock, memory_order_acquire) );
+        begin = p_range->begin;
+        end   = ( p_range->end - begin > p_job->grain ) ? begin + p_job->grain : p_range->end;
+        p_range->begin = end;
+        atomic_flag_clear_explicit(&p_range->_lock, memory_order_release);
+
+        // Process it
+        if ( begin < end )
+        {
+            tuple_parallel_chunk(p_job, p_range, begin, end);
+            continue;
+        }
+
+        // Steal the back half of another thread's range
+        for (size_t i = 1; i < p_job->threads && begin == end; i++)
+        {
+
+            // Initialized data
+            struct tuple_parallel_range_s *p_victim = &p_job->_ranges[( self + i ) % p_job->threads];
+            size_t                         length   = 0;
+
+            // Split the victim's range
+            while ( atomic_flag_test_and_set_explicit(&p_victim->_lock, memory_order_acquire) );
+            length = p_victim->end - p_victim->begin;
+            if ( length )
+            {
+                end            = p_victim->end;
+                begin          = ( length > p_job->grain ) ? end - length / 2 : p_victim->begin;
+                p_victim->end  = begin;
+            }
+            atomic_flag_clear_explicit(&p_victim->_lock, memory_order_release);
+        }
+
+        // Every range is empty
+        if ( begin == end ) break;
+
+        // Adopt the stolen range
+        while ( atomic_flag_test_and_set_explicit(&p_range->_lock, memory_order_acquire) );
+        p_range->begin = begin;
+        p_range->end   = end;
+        atomic_flag_clear_explicit(&p_range->_lock, memory_order_release);
+    }
+
+    // Done
+    return;
+}
+
+#ifndef _WIN64
+/** !
+ * Worker thread. Wait for a job, take part in it, and report back
+ * 
+ * @param p_parameter unused
+ * 
+ * @return null pointer
+ */
+static void *tuple_parallel_worker_main ( void *p_parameter )
+{
+
+    // Initialized data. Workers start with the pool at generation 0, so a job posted
+    // before this thread got the lock is still seen as new
+    size_t seen = 0;
+
+    // Unused
+    (void) p_parameter;
+
+    // Parallel calls from a callback run serially on the worker
+    tuple_parallel_active = true;
+
+    // Lock
+    pthread_mutex_lock(&tuple_workers._lock);
+
+    // Until the pool stops
+    for (;;)
+    {
+
+        // Initialized data
+        struct tuple_parallel_job_s *p_job = (void *) 0;
+
+        // Wait for a job
+        while ( tuple_workers.generation == seen && tuple_workers.stop == false )
+            pthread_cond_wait(&tuple_workers._start, &tuple_workers._lock);
+
+        // Stop
+        if ( tuple_workers.stop ) break;
+
+        // Take the job
+        seen  = tuple_workers.generation;
+        p_job = tuple_workers.p_job;
+
+        // Unlock
+        pthread_mutex_unlock(&tuple_workers._lock);
+
+        // Work
+        tuple_parallel_run(p_job);
+
+        // Lock
+        pthread_mutex_lock(&tuple_workers._lock);
+
+        // The last worker out wakes the caller
+        if ( --tuple_workers.active == 0 ) pthread_cond_signal(&tuple_workers._done);
+    }
+
+    // Unlock
+    pthread_mutex_unlock(&tuple_workers._lock);
+
+    // Done
+    return (void *) 0;
+}
+
+/** !
+ * Stop and join every worker. The caller holds the job lock
+ * 
+ * @param void
+ * 
+ * @return void
+ */
+static void tuple_parallel_stop ( void )
+{
+
+    // Tell the workers to stop
+    pthread_mutex_lock(&tuple_workers._lock);
+    tuple_workers.stop = true;
+    pthread_cond_broadcast(&tuple_workers._start);
+    pthread_mutex_unlock(&tuple_workers._lock);
+
+    // Join them
+    for (size_t i = 0; i < tuple_workers.count; i++) pthread_join(tuple_workers._threads[i], 0);
+
+    // Empty
+    tuple_workers.count      = 0;
+    tuple_workers.generation = 0;
+    tuple_workers.stop       = false;
+
+    // Done
+    return;
+}
+
+/** !
+ * Start the workers, if they are not running. The caller holds the job lock
+ * 
+ * @param void
+ * 
+ * @return quantity of running workers
+ */
+static size_t tuple_parallel_start ( void )
+{
+
+    // Initialized data
+    size_t count = tuple_workers.requested;
+
+    // Fast exit
+    if ( tuple_workers.count ) return tuple_workers.count;
+
+    // One thread for each processor
+    if ( count == 0 )
+    {
+
+        // Initialized data
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+        // Store
+        count = ( processors > 1 ) ? (size_t) processors : 1;
+    }
+
+    // The caller is one of the threads
+    count--;
+
+    // Clamp
+    if ( count > TUPLE_WORKERS_MAX ) count = TUPLE_WORKERS_MAX;
+
+    // Start each worker. A worker that fails to start leaves a smaller pool
+    while ( tuple_workers.count < count )
+    {
+
+        // Start a worker
+        if ( pthread_create(&tuple_workers._threads[tuple_workers.count], 0, tuple_parallel_worker_main, 0) ) break;
+
+        // Count it
+        tuple_workers.count++;
+    }
+
+    // Done
+    return tuple_workers.count;
+}
+#endif
+
+/** !
+ * Run a job on the caller and the worker pool
+ * 
+ * @param p_job the job, with every field but the ranges set
+ * @param p_identity the value each partial reduction starts from
+ * 
+ * @return void
+ */
+static void tuple_parallel ( struct tuple_parallel_job_s *p_job, void *p_identity )
+{
+
+    // Initialized data
+    size_t length  = p_job->length,
+           workers = 0;
+    bool   nested  = tuple_parallel_active;
+
+    // Nested calls from a callback run serially on the calling thread
+    #ifndef _WIN64
+        if ( nested == false )
+        {
+            pthread_mutex_lock(&tuple_workers._job_lock);
+            workers = tuple_parallel_start();
+        }
+    #endif
+
+    // Mark the calling thread
+    tuple_parallel_active = true;
+
+    // Default grain size
+    if ( p_job->grain == 0 ) p_job->grain = length / ( ( workers + 1 ) * TUPLE_PARALLEL_CHUNKS );
+    if ( p_job->grain == 0 ) p_job->grain = 1;
+
+    // Small tuples are not worth waking the pool for
+    if ( length <= p_job->grain ) workers = 0;
+
+    // Split the index range evenly between the caller and the workers
+    p_job->threads = workers + 1;
+    atomic_init(&p_job->next, 0);
+    for (size_t i = 0; i < p_job->threads; i++)
+    {
+        atomic_flag_clear(&p_job->_ranges[i]._lock);
+        p_job->_ranges[i].begin     = length * i / p_job->threads;
+        p_job->_ranges[i].end       = length * ( i + 1 ) / p_job->threads;
+        p_job->_ranges[i].p_partial = p_identity;
+    }
+
+    // Post the job
+    #ifndef _WIN64
+        if ( workers )
+        {
+            pthread_mutex_lock(&tuple_workers._lock);
+            tuple_workers.p_job  = p_job;
+            tuple_workers.active = tuple_workers.count;
+            tuple_workers.generation++;
+            pthread_cond_broadcast(&tuple_workers._start);
+            pthread_mutex_unlock(&tuple_workers._lock);
+        }
+    #endif
+
+    // Take part
+    tuple_parallel_run(p_job);
+
+    // Wait for the workers, which may still be touching the job
+    #ifndef _WIN64
+        if ( workers )
+        {
+            pthread_mutex_lock(&tuple_workers._lock);
+            while ( tuple_workers.active ) pthread_cond_wait(&tuple_workers._done, &tuple_workers._lock);
+            tuple_workers.p_job = (void *) 0;
+            pthread_mutex_unlock(&tuple_workers._lock);
+        }
+
+        // Let the next job in
+        if ( nested == false ) pthread_mutex_unlock(&tuple_workers._job_lock);
+    #endif
+
+    // Unmark the calling thread
+    tuple_parallel_active = nested;
+
+    // Done
+    return;
+}
+
+/** !
+ * Run a range job on the caller and the worker pool
+ * 
+ * @param pfn_range function called on each chunk of [ 0, length )
+ * @param p_context passed to pfn_range
+ * @param length    quantity of indices
+ * @param grain     indices claimed at once, or 0 to let the library choose
+ * 
+ * @return void
+ */
+static void tuple_parallel_for ( void (*pfn_range)(void *const p_context, size_t begin, size_t end), void *p_context, size_t length, size_t grain )
+{
+
+    // Initialized data
+    struct tuple_parallel_job_s job = 
+    {
+        .pfn_range = pfn_range,
+        .p_context = p_context,
+        .length    = length,
+        .grain     = grain
+    };
+
+    // Run
+    tuple_parallel(&job, (void *) 0);
+
+    // Done
+    return;
+}
+
+int tuple_foreach_parallel ( const tuple *const p_tuple, void (*const pfn_function)(void *const value, size_t index), size_t grain )
+{
+
+    // Argument check
+    if ( p_tuple      == (void *) 0 ) goto no_tuple;
+    if ( pfn_function == (void *) 0 ) goto no_func;
+
+    // Persistent tuples are flattened up front, so no worker has to
+    if ( tuple_elements(p_tuple) == (void *) 0 ) goto no_mem;
+
+    // Initialized data
+    struct tuple_parallel_job_s job = 
+    {
+        .p_tuple      = p_tuple,
+        .pfn_function = pfn_function,
+        .length       = p_tuple->element_count,
+        .grain        = grain
+    };
+
+    // Run
+    tuple_parallel(&job, (void *) 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+            
+            no_func:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_function\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_reduce_parallel ( const tuple *const p_tuple, void *(*const pfn_map)(void *const value, size_t index), void *(*const pfn_reduce)(void *const left, void *const right), void *const p_identity, size_t grain, void **const pp_result )
+{
+
+    // Argument check
+    if ( p_tuple    == (void *) 0 ) goto no_tuple;
+    if ( pfn_map    == (void *) 0 ) goto no_func;
+    if ( pfn_reduce == (void *) 0 ) goto no_func;
+    if ( pp_result  == (void *) 0 ) goto no_value;
+
+    // Persistent tuples are flattened up front, so no worker has to
+    if ( tuple_elements(p_tuple) == (void *) 0 ) goto no_mem;
+
+    // Initialized data
+    void                       *p_result = p_identity;
+    struct tuple_parallel_job_s job      = 
+    {
+        .p_tuple    = p_tuple,
+        .pfn_map    = pfn_map,
+        .pfn_reduce = pfn_reduce,
+        .length     = p_tuple->element_count,
+        .grain      = grain
+    };
+
+    // Run
+    tuple_parallel(&job, p_identity);
+
+    // Combine each thread's partial
+    for (size_t i = 0; i < job.threads; i++) p_result = pfn_reduce(p_result, job._ranges[i].p_partial);
+
+    // Return a pointer to the caller
+    *pp_result = p_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+            
+            no_func:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_map\" or \"pfn_reduce\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_parallel_threads ( size_t count )
+{
+
+    // Argument check
+    if ( count > TUPLE_WORKERS_MAX + 1 ) goto too_many_threads;
+
+    // Restart the pool with the new size on the next parallel call
+    #ifndef _WIN64
+        pthread_mutex_lock(&tuple_workers._job_lock);
+        tuple_parallel_stop();
+        tuple_workers.requested = count;
+        pthread_mutex_unlock(&tuple_workers._job_lock);
+    #endif
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            too_many_threads:
+                TUPLE_ERROR(TUPLE_STATUS_TOO_MANY_ELEMENTS, "[tuple] Parameter \"count\" is larger than %d in call to function \"%s\"\n", TUPLE_WORKERS_MAX + 1, __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_hash ( const tuple *const p_tuple, unsigned long long (*const pfn_element_hash)(const void *const value), unsigned long long *const p_hash )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( p_hash  == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    unsigned long long  hash       = 0,
+                        cached     = TUPLE_HASH_UPDATED;
+    void *const        *p_elements = (void *) 0;
+    atomic_ullong      *p_slot     = tuple_hash_slot(p_tuple);
+
+    // Content hashes depend on the callback, so they are not cached
+    if ( pfn_element_hash )
+    {
+
+        // Get the elements
+        p_elements = tuple_elements(p_tuple);
+
+        // Error check
+        if ( p_elements == (void *) 0 ) goto no_mem;
+
+        // Return the hash to the caller
+        *p_hash = tuple_hash_elements(p_elements, p_tuple->element_count, pfn_element_hash);
+
+        // Success
+        return 1;
+    }
+
+    // Fast exit. Only a tuple that has never been updated in place publishes a hash, so a
+    // cached hash is current until the next tuple_set, tuple_exchange or tuple_compare_exchange
+    if ( p_slot ) cached = atomic_load_explicit(p_slot, memory_order_relaxed);
+    hash = cached;
+    if ( TUPLE_LIKELY(hash != TUPLE_HASH_NONE && hash != TUPLE_HASH_UPDATED) ) goto done;
+
+    // Get the elements
+    p_elements = tuple_elements(p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Hash the pointers
+    hash = tuple_hash_identity(tuple_hash_elements(p_elements, p_tuple->element_count, (void *) 0));
+
+    // Publish it only over TUPLE_HASH_NONE. An update in place marks the slot before it changes
+    // an element, so if this read the old elements, either the mark fails the exchange or it
+    // lands afterwards, over this hash
+    if ( cached == TUPLE_HASH_NONE ) atomic_compare_exchange_strong_explicit(p_slot, &cached, hash, memory_order_relaxed, memory_order_relaxed);
+
+    done:
+
+    // Return the hash to the caller
+    *p_hash = hash;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"p_hash\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool tuple_equals ( const tuple *const p_a, const tuple *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Argument check
+    if ( p_a == (void *) 0 ) goto no_tuple;
+    if ( p_b == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    atomic_ullong      *p_a_slot     = tuple_hash_slot(p_a),
+                       *p_b_slot     = tuple_hash_slot(p_b);
+    unsigned long long  a_hash       = ( p_a_slot ) ? atomic_load_explicit(p_a_slot, memory_order_relaxed) : TUPLE_HASH_NONE,
+                        b_hash       = ( p_b_slot ) ? atomic_load_explicit(p_b_slot, memory_order_relaxed) : TUPLE_HASH_NONE;
+    void *const        *p_a_elements = (void *) 0;
+    void *const        *p_b_elements = (void *) 0;
+
+    // Tuples with different identity hashes cannot hold the same pointers
+    if ( a_hash == TUPLE_HASH_UPDATED ) a_hash = TUPLE_HASH_NONE;
+    if ( b_hash == TUPLE_HASH_UPDATED ) b_hash = TUPLE_HASH_NONE;
+    if ( pfn_compare == (void *) 0 && a_hash && b_hash && a_hash != b_hash ) return false;
+
+    // Tuples of different sizes are never equal
+    if ( p_a->element_count != p_b->element_count ) return false;
+
+    // Get the elements
+    p_a_elements = tuple_elements(p_a);
+    p_b_elements = tuple_elements(p_b);
+
+    // Error check
+    if ( p_a_elements == (void *) 0 || p_b_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_equals_elements(p_a_elements, p_a->element_count, p_b_elements, p_b->element_count, pfn_compare);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_a\" or \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+int tuple_compare ( const tuple *const p_a, const tuple *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Argument check
+    if ( p_a == (void *) 0 ) goto no_tuple;
+    if ( p_b == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    void *const *p_a_elements = tuple_elements(p_a);
+    void *const *p_b_elements = tuple_elements(p_b);
+
+    // Error check
+    if ( p_a_elements == (void *) 0 || p_b_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_compare_elements(p_a_elements, p_a->element_count, p_b_elements, p_b->element_count, pfn_compare);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_a\" or \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool tuple_view_equals ( const tuple_view *const p_a, const tuple_view *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Argument check
+    if ( p_a == (void *) 0 ) goto no_view;
+    if ( p_b == (void *) 0 ) goto no_view;
+
+    // Initialized data
+    void *const *p_a_elements = tuple_elements(p_a->p_tuple);
+    void *const *p_b_elements = tuple_elements(p_b->p_tuple);
+
+    // Error check
+    if ( p_a_elements == (void *) 0 || p_b_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_equals_elements(&p_a_elements[p_a->offset], p_a->length, &p_b_elements[p_b->offset], p_b->length, pfn_compare);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_a\" or \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+int tuple_view_compare ( const tuple_view *const p_a, const tuple_view *const p_b, int (*const pfn_compare)(const void *const a, const void *const b) )
+{
+
+    // Argument check
+    if ( p_a == (void *) 0 ) goto no_view;
+    if ( p_b == (void *) 0 ) goto no_view;
+
+    // Initialized data
+    void *const *p_a_elements = tuple_elements(p_a->p_tuple);
+    void *const *p_b_elements = tuple_elements(p_b->p_tuple);
+
+    // Error check
+    if ( p_a_elements == (void *) 0 || p_b_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_compare_elements(&p_a_elements[p_a->offset], p_a->length, &p_b_elements[p_b->offset], p_b->length, pfn_compare);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_view:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VIEW, "[tuple] Null pointer provided for parameter \"p_a\" or \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool tuple_find ( const tuple *const p_tuple, const void *const value, size_t *const p_index )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( p_index == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+    size_t       offset     = 0;
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Search
+    offset = tuple_search(p_elements, p_tuple->element_count, value);
+
+    // Not found
+    if ( offset == p_tuple->element_count ) return false;
+
+    // Return the index
+    *p_index = offset;
+
+    // Success
+    return true;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"p_index\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+bool tuple_find_last ( const tuple *const p_tuple, const void *const value, size_t *const p_index )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( p_index == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+    size_t       offset     = 0;
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Search from the back
+    offset = tuple_search_last(p_elements, p_tuple->element_count, value);
+
+    // Not found
+    if ( offset == p_tuple->element_count ) return false;
+
+    // Return the index
+    *p_index = offset;
+
+    // Success
+    return true;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"p_index\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+bool tuple_contains ( const tuple *const p_tuple, const void *const value )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_search(p_elements, p_tuple->element_count, value) != p_tuple->element_count;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+size_t tuple_count ( const tuple *const p_tuple, const void *const value )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_search_count(p_elements, p_tuple->element_count, value);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool tuple_find_if ( const tuple *const p_tuple, bool (*const pfn_predicate)(void *const value, size_t index), size_t *const p_index )
+{
+
+    // Argument check
+    if ( p_tuple       == (void *) 0 ) goto no_tuple;
+    if ( pfn_predicate == (void *) 0 ) goto no_function;
+    if ( p_index       == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+    size_t       count      = p_tuple->element_count,
+                 i          = 0;
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Four elements per iteration, so the loop overhead is paid once per four calls
+    for (; i + 4 <= count; i += 4)
+    {
+        if ( pfn_predicate(p_elements[i    ], i    ) ) goto found;
+        if ( pfn_predicate(p_elements[i + 1], i + 1) ) { i += 1; goto found; }
+        if ( pfn_predicate(p_elements[i + 2], i + 2) ) { i += 2; goto found; }
+        if ( pfn_predicate(p_elements[i + 3], i + 3) ) { i += 3; goto found; }
+    }
+
+    // Test what is left
+    for (; i < count; i++) if ( pfn_predicate(p_elements[i], i) ) goto found;
+
+    // Not found
+    return false;
+
+    found:
+
+    // Return the index
+    *p_index = i;
+
+    // Success
+    return true;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            no_function:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_predicate\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"p_index\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+/** !
+ * Compare two sort rows, key by key
+ * 
+ * @param p_sort the sort
+ * @param p_a    a row
+ * @param p_b    another row
+ * 
+ * @return negative if p_a goes first, positive if p_b goes first, 0 if their keys are equal
+ */
+static int tuple_sort_compare ( const struct tuple_sort_s *p_sort, void *const *p_a, void *const *p_b )
+{
+
+    // Each key, most significant first
+    for (size_t i = 0; i < p_sort->keys; i++)
+    {
+
+        // Initialized data
+        int (*pfn_compare)(const void *const a, const void *const b) = p_sort->p_keys[i].pfn_compare;
+        int   result                                                  = 0;
+
+        // Compare the elements with the callback ...
+        if ( pfn_compare ) result = pfn_compare(p_a[i], p_b[i]);
+
+        // ... or by address
+        else result = ( (uintptr_t) p_a[i] > (uintptr_t) p_b[i] ) - ( (uintptr_t) p_a[i] < (uintptr_t) p_b[i] );
+
+        // Equal keys fall through to the next one
+        if ( result == 0 ) continue;
+
+        // Done
+        return ( p_sort->p_keys[i].descending ) ? ( ( result < 0 ) ? 1 : -1 ) : result;
+    }
+
+    // Every key is equal
+    return 0;
+}
+
+/** !
+ * Copy the keys of every tuple in a range of blocks into their rows. For a radix sort, also
+ * note which key bits differ inside each block
+ * 
+ * @param p_context the sort
+ * @param begin     first block
+ * @param end       one past the last block
+ * 
+ * @return void
+ */
+static void tuple_sort_extract ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_sort_s *p_sort = p_context;
+
+    // Each block
+    for (size_t b = begin; b < end; b++)
+    {
+
+        // Initialized data
+        size_t     first  = b * TUPLE_SORT_BLOCK,
+                   last   = ( p_sort->count - first > TUPLE_SORT_BLOCK ) ? first + TUPLE_SORT_BLOCK : p_sort->count;
+        void     **p_head = &p_sort->p_rows[first * p_sort->width];
+        uintptr_t *p_diff = ( p_sort->radix ) ? &p_sort->p_diff[b * p_sort->keys] : (void *) 0;
+
+        // Nothing differs yet
+        if ( p_diff ) memset(p_diff, 0, p_sort->keys * sizeof(uintptr_t));
+
+        // Each tuple in the block
+        for (size_t i = first; i < last; i++)
+        {
+
+            // Initialized data
+            tuple  *p_tuple = p_sort->pp_tuples[i];
+            void  **p_row   = &p_sort->p_rows[i * p_sort->width];
+
+            // Error check
+            if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+            // Each key
+            for (size_t k = 0; k < p_sort->keys; k++)
+            {
+
+                // Initialized data
+                size_t    offset = 0;
+                uintptr_t key    = 0;
+
+                // Tuples may differ in size, so each one checks the index
+                if ( tuple_offset(p_sort->p_keys[k].index, p_tuple->element_count, &offset) == 0 ) goto bounds_error;
+
+                // Get the element
+                key = (uintptr_t) tuple_element(p_tuple, offset);
+
+                // Radix passes order by the stored bits, so descending keys are stored inverted
+                if ( p_diff && p_sort->p_keys[k].descending ) key = ~key;
+
+                // Store the key
+                p_row[k] = (void *) key;
+
+                // Note the bits that differ from the first row of the block
+                if ( p_diff ) p_diff[k] |= key ^ (uintptr_t) p_head[k];
+            }
+
+            // The tuple rides along after its keys
+            p_row[p_sort->keys] = p_tuple;
+        }
+    }
+
+    // Done
+    return;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+
+                // Fail the sort
+                atomic_store_explicit(&p_sort->status, TUPLE_STATUS_NO_TUPLE, memory_order_relaxed);
+
+                // Error
+                return;
+
+            bounds_error:
+
+                // Fail the sort
+                atomic_store_explicit(&p_sort->status, TUPLE_STATUS_BOUNDS_ERROR, memory_order_relaxed);
+
+                // Error
+                return;
+        }
+    }
+}
+
+/** !
+ * Count the rows in each block with each value of the current radix digit
+ * 
+ * @param p_context the sort
+ * @param begin     first block
+ * @param end       one past the last block
+ * 
+ * @return void
+ */
+static void tuple_sort_count ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_sort_s *p_sort = p_context;
+
+    // Each block
+    for (size_t b = begin; b < end; b++)
+    {
+
+        // Initialized data
+        size_t        first    = b * TUPLE_SORT_BLOCK,
+                      last     = ( p_sort->count - first > TUPLE_SORT_BLOCK ) ? first + TUPLE_SORT_BLOCK : p_sort->count;
+        size_t       *p_counts = &p_sort->p_counts[b * 256];
+        void *const  *p_key    = &p_sort->p_rows[first * p_sort->width + p_sort->key];
+
+        // Clear the counts
+        memset(p_counts, 0, 256 * sizeof(size_t));
+
+        // Count each digit
+        for (size_t i = first; i < last; i++, p_key += p_sort->width)
+            p_counts[( (uintptr_t) *p_key >> p_sort->shift ) & 0xff]++;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Move the rows in each block to where the current radix digit puts them
+ * 
+ * @param p_context the sort
+ * @param begin     first block
+ * @param end       one past the last block
+ * 
+ * @return void
+ */
+static void tuple_sort_scatter ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_sort_s *p_sort = p_context;
+    size_t               width  = p_sort->width;
+
+    // Each block
+    for (size_t b = begin; b < end; b++)
+    {
+
+        // Initialized data
+        size_t        first     = b * TUPLE_SORT_BLOCK,
+                      last      = ( p_sort->count - first > TUPLE_SORT_BLOCK ) ? first + TUPLE_SORT_BLOCK : p_sort->count;
+        size_t       *p_offsets = &p_sort->p_counts[b * 256];
+        void *const  *p_row     = &p_sort->p_rows[first * width];
+
+        // Each row, in order, so rows with equal digits keep their order
+        for (size_t i = first; i < last; i++, p_row += width)
+        {
+
+            // Initialized data
+            size_t   digit = ( (uintptr_t) p_row[p_sort->key] >> p_sort->shift ) & 0xff;
+            void   **p_out = &p_sort->p_scratch[p_offsets[digit]++ * width];
+
+            // Copy the row
+            for (size_t w = 0; w < width; w++) p_out[w] = p_row[w];
+        }
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Insertion sort each run of TUPLE_SORT_RUN rows in a range
+ * 
+ * @param p_context the sort
+ * @param begin     first run
+ * @param end       one past the last run
+ * 
+ * @return void
+ */
+static void tuple_sort_runs ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_sort_s *p_sort = p_context;
+    size_t               width  = p_sort->width;
+
+    // Each run
+    for (size_t r = begin; r < end; r++)
+    {
+
+        // Initialized data
+        size_t first = r * TUPLE_SORT_RUN,
+               last  = ( p_sort->count - first > TUPLE_SORT_RUN ) ? first + TUPLE_SORT_RUN : p_sort->count;
+
+        // Insert each row into the sorted rows before it
+        for (size_t i = first + 1; i < last; i++)
+        {
+
+            // Initialized data
+            void   *_p_row[TUPLE_SORT_KEYS_MAX + 1];
+            size_t  j = i;
+
+            // Lift the row out
+            for (size_t w = 0; w < width; w++) _p_row[w] = p_sort->p_rows[i * width + w];
+
+            // Shift every row that goes after it up by one. Equal rows stay in front
+            for (; j > first && tuple_sort_compare(p_sort, &p_sort->p_rows[( j - 1 ) * width], _p_row) > 0; j--)
+                for (size_t w = 0; w < width; w++) p_sort->p_rows[j * width + w] = p_sort->p_rows[( j - 1 ) * width + w];
+
+            // Drop the row in
+            for (size_t w = 0; w < width; w++) p_sort->p_rows[j * width + w] = _p_row[w];
+        }
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Write a range of TUPLE_SORT_SEGMENT row segments of the current merge pass. Each segment
+ * finds where it starts in the two runs it draws from with a binary search, so every segment
+ * of every pass can be merged independently
+ * 
+ * @param p_context the sort
+ * @param begin     first segment
+ * @param end       one past the last segment
+ * 
+ * @return void
+ */
+static void tuple_sort_merge ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_sort_s *p_sort = p_context;
+    size_t               width  = p_sort->width,
+                         run    = p_sort->run,
+                         out    = begin * TUPLE_SORT_SEGMENT,
+                         stop   = ( p_sort->count / TUPLE_SORT_SEGMENT >= end ) ? end * TUPLE_SORT_SEGMENT : p_sort->count;
+
+    // Until the range is written. A range may span the end of one pair of runs and the start of the next
+    while ( out < stop )
+    {
+
+        // Initialized data
+        size_t        lower    = out / ( 2 * run ) * ( 2 * run ),
+                      middle   = ( p_sort->count - lower > run ) ? lower + run : p_sort->count,
+                      upper    = ( p_sort->count - middle > run ) ? middle + run : p_sort->count,
+                      last     = ( upper < stop ) ? upper : stop,
+                      length_a = middle - lower,
+                      length_b = upper - middle,
+                      rank     = out - lower,
+                      low      = ( rank > length_b ) ? rank - length_b : 0,
+                      high     = ( rank < length_a ) ? rank : length_a,
+                      i        = 0,
+                      j        = 0;
+        void *const  *p_a      = &p_sort->p_rows[lower * width];
+        void *const  *p_b      = &p_sort->p_rows[middle * width];
+        void        **p_out    = &p_sort->p_scratch[out * width];
+
+        // Find how many of the first rank rows come from the first run. Ties go to the first run
+        while ( low < high )
+        {
+
+            // Initialized data
+            size_t half = low + ( high - low ) / 2;
+
+            // The row before it in the second run goes strictly first, so take no more from the first run
+            if ( rank - half == 0 || tuple_sort_compare(p_sort, &p_b[( rank - half - 1 ) * width], &p_a[half * width]) < 0 ) high = half;
+
+            // Take more from the first run
+            else low = half + 1;
+        }
+
+        // Start there
+        i = low;
+        j = rank - low;
+
+        // Merge
+        for (; out < last; out++, p_out += width)
+        {
+
+            // Initialized data. Take from the first run on ties, so the merge is stable. Random
+            // keys make this choice a coin flip, so it is made without a branch
+            size_t       first = ( j >= length_b ) || ( i < length_a && tuple_sort_compare(p_sort, &p_a[i * width], &p_b[j * width]) <= 0 );
+            void *const *p_row = ( first ) ? &p_a[i * width] : &p_b[j * width];
+
+            // Advance whichever run was taken from
+            i += first;
+            j += first ^ 1;
+
+            // Copy the row
+            for (size_t w = 0; w < width; w++) p_out[w] = p_row[w];
+        }
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Write the tuples of a range of sorted rows back to the caller's array
+ * 
+ * @param p_context the sort
+ * @param begin     first row
+ * @param end       one past the last row
+ * 
+ * @return void
+ */
+static void tuple_sort_store ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_sort_s *p_sort = p_context;
+
+    // Each row
+    for (size_t i = begin; i < end; i++) p_sort->pp_tuples[i] = p_sort->p_rows[i * p_sort->width + p_sort->keys];
+
+    // Done
+    return;
+}
+
+int tuple_array_sort ( tuple **const pp_tuples, size_t count, const tuple_sort_key *const p_keys, size_t key_count )
+{
+
+    // Argument check
+    if ( pp_tuples == (void *) 0 ) goto no_tuple;
+    if ( p_keys    == (void *) 0 ) goto no_keys;
+    if ( key_count == 0 )          goto no_keys;
+    if ( key_count >  TUPLE_SORT_KEYS_MAX ) goto too_many_keys;
+
+    // Initialized data
+    size_t              blocks = ( count + TUPLE_SORT_BLOCK - 1 ) / TUPLE_SORT_BLOCK;
+    int                 status = TUPLE_STATUS_OK;
+    void              **p_swap = (void *) 0;
+    struct tuple_sort_s sort   = 
+    {
+        .pp_tuples = pp_tuples,
+        .p_keys    = p_keys,
+        .keys      = key_count,
+        .width     = key_count + 1,
+        .count     = count,
+        .radix     = ( count >= TUPLE_SORT_RADIX_MIN )
+    };
+
+    // Fast exit
+    if ( count == 0 ) return 1;
+
+    // Radix passes can only order by address
+    for (size_t k = 0; k < key_count; k++) if ( p_keys[k].pfn_compare ) sort.radix = false;
+
+    // Overflow check
+    if ( count > ( (size_t) -1 / 2 ) / ( sort.width * sizeof(void *) ) ) goto no_mem;
+
+    // Allocate the rows and the scratch rows together
+    sort.p_rows = TUPLE_REALLOC(0, 2 * count * sort.width * sizeof(void *));
+
+    // Error check
+    if ( sort.p_rows == (void *) 0 ) goto no_mem;
+
+    // The scratch rows start after the rows
+    sort.p_scratch = &sort.p_rows[count * sort.width];
+
+    // Radix sorts count digits in each block
+    if ( sort.radix )
+    {
+
+        // Allocate the per block bookkeeping
+        sort.p_diff   = TUPLE_REALLOC(0, blocks * key_count * sizeof(uintptr_t));
+        sort.p_counts = TUPLE_REALLOC(0, blocks * 256 * sizeof(size_t));
+
+        // Error check
+        if ( sort.p_diff == (void *) 0 || sort.p_counts == (void *) 0 ) goto failed_to_allocate;
+    }
+
+    // Nothing has failed yet
+    atomic_init(&sort.status, TUPLE_STATUS_OK);
+
+    // Copy the keys into their rows
+    tuple_parallel_for(tuple_sort_extract, &sort, blocks, 1);
+
+    // Error check
+    status = atomic_load_explicit(&sort.status, memory_order_relaxed);
+    if ( status != TUPLE_STATUS_OK ) goto failed_to_extract;
+
+    // Radix sort, least significant digit of the least significant key first
+    if ( sort.radix )
+    {
+
+        // Each key
+        for (size_t k = key_count; k-- > 0;)
+        {
+
+            // Initialized data
+            uintptr_t diff = 0;
+
+            // Bits that differ anywhere, between or inside blocks
+            for (size_t b = 0; b < blocks; b++)
+                diff |= sort.p_diff[b * key_count + k] | ( (uintptr_t) sort.p_rows[b * TUPLE_SORT_BLOCK * sort.width + k] ^ (uintptr_t) sort.p_rows[k] );
+
+            // Each digit
+            for (unsigned int shift = 0; shift < sizeof(uintptr_t) * 8; shift += 8)
+            {
+
+                // Initialized data
+                size_t offset = 0;
+
+                // Every row has the same digit, so the pass would not move anything
+                if ( ( ( diff >> shift ) & 0xff ) == 0 ) continue;
+
+                // Set the digit
+                sort.key   = k;
+                sort.shift = shift;
+
+                // Count it
+                tuple_parallel_for(tuple_sort_count, &sort, blocks, 1);
+
+                // Each block writes each digit after every smaller digit, and after the same digit from earlier blocks
+                for (size_t d = 0; d < 256; d++)
+                    for (size_t b = 0; b < blocks; b++)
+                    {
+
+                        // Initialized data
+                        size_t quantity = sort.p_counts[b * 256 + d];
+
+                        // Turn the count into an offset
+                        sort.p_counts[b * 256 + d] = offset;
+                        offset += quantity;
+                    }
+
+                // Scatter
+                tuple_parallel_for(tuple_sort_scatter, &sort, blocks, 1);
+
+                // The scratch rows are the rows now
+                p_swap         = sort.p_rows;
+                sort.p_rows    = sort.p_scratch;
+                sort.p_scratch = p_swap;
+            }
+        }
+    }
+
+    // Merge sort
+    else
+    {
+
+        // Sort short runs in place
+        tuple_parallel_for(tuple_sort_runs, &sort, ( count + TUPLE_SORT_RUN - 1 ) / TUPLE_SORT_RUN, 0);
+
+        // Merge pairs of runs until one is left
+        for (sort.run = TUPLE_SORT_RUN; sort.run < count; sort.run *= 2)
+        {
+
+            // Merge
+            tuple_parallel_for(tuple_sort_merge, &sort, ( count + TUPLE_SORT_SEGMENT - 1 ) / TUPLE_SORT_SEGMENT, 1);
+
+            // The scratch rows are the rows now
+            p_swap         = sort.p_rows;
+            sort.p_rows    = sort.p_scratch;
+            sort.p_scratch = p_swap;
+        }
+    }
+
+    // Write the tuples back in order
+    tuple_parallel_for(tuple_sort_store, &sort, count, 0);
+
+    // Free the rows, and the radix bookkeeping. Either half of the rows may be the start of the block
+    sort.p_rows = TUPLE_REALLOC(( sort.p_rows < sort.p_scratch ) ? sort.p_rows : sort.p_scratch, 0);
+    if ( sort.p_diff   ) sort.p_diff   = TUPLE_REALLOC(sort.p_diff, 0);
+    if ( sort.p_counts ) sort.p_counts = TUPLE_REALLOC(sort.p_counts, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_keys:
+                TUPLE_ERROR(TUPLE_STATUS_NO_KEYS, "[tuple] Null pointer, or no keys, provided for parameter \"p_keys\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            too_many_keys:
+                TUPLE_ERROR(TUPLE_STATUS_TOO_MANY_ELEMENTS, "[tuple] Parameter \"key_count\" is larger than %d in call to function \"%s\"\n", TUPLE_SORT_KEYS_MAX, __FUNCTION__);
+
+                // Error
+                return 0;
+
+            failed_to_extract:
+
+                // Free the rows
+                sort.p_rows = TUPLE_REALLOC(sort.p_rows, 0);
+                if ( sort.p_diff   ) sort.p_diff   = TUPLE_REALLOC(sort.p_diff, 0);
+                if ( sort.p_counts ) sort.p_counts = TUPLE_REALLOC(sort.p_counts, 0);
+
+                // A tuple is missing ...
+                if ( status == TUPLE_STATUS_NO_TUPLE )
+                    TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null tuple in parameter \"pp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // ... or too short for a key
+                else
+                    TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Key index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            failed_to_allocate:
+
+                // Free whatever was allocated
+                sort.p_rows = TUPLE_REALLOC(sort.p_rows, 0);
+                if ( sort.p_diff   ) sort.p_diff   = TUPLE_REALLOC(sort.p_diff, 0);
+                if ( sort.p_counts ) sort.p_counts = TUPLE_REALLOC(sort.p_counts, 0);
+
+                // Report
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Compute a tuple's join entry key. One key position uses the element itself. Several are
+ * hashed together, so a match on the hash is checked again element by element
+ * 
+ * @param p_join  the join
+ * @param p_side  the side the tuple is on
+ * @param p_tuple the tuple
+ * @param p_key   return
+ * 
+ * @return 1 on success, 0 if a key position is out of bounds
+ */
+static int tuple_join_fold ( const struct tuple_join_s *p_join, const struct tuple_join_side_s *p_side, const tuple *p_tuple, unsigned long long *p_key )
+{
+
+    // Initialized data
+    unsigned long long key = 0;
+
+    // Each key position
+    for (size_t k = 0; k < p_join->keys; k++)
+    {
+
+        // Initialized data
+        size_t             offset  = 0;
+        unsigned long long element = 0;
+
+        // Tuples may differ in size, so each one checks the position
+        if ( tuple_offset(p_side->p_keys[k], p_tuple->element_count, &offset) == 0 ) return 0;
+
+        // Get the element
+        element = (unsigned long long) (size_t) tuple_element(p_tuple, offset);
+
+        // Fold it in
+        key = ( p_join->keys == 1 ) ? element : tuple_hash_mix(key ^ element, 0x9e3779b97f4a7c15ULL + k);
+    }
+
+    // Return the key to the caller
+    *p_key = key;
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Spread an entry key over 64 bits. The top bits pick the partition, and the bits below them
+ * pick the bucket, so aligned addresses and small integers still spread evenly
+ * 
+ * @param key the entry key
+ * 
+ * @return the spread key
+ */
+static inline unsigned long long tuple_join_spread ( unsigned long long key )
+{
+
+    // Done
+    return tuple_hash_mix(key ^ 0xe7037ed1a0b428dbULL, 0xa0761d6478bd642fULL);
+}
+
+/** !
+ * Get the partition an entry key falls in
+ * 
+ * @param p_join the join
+ * @param key    the entry key
+ * 
+ * @return the partition
+ */
+static inline size_t tuple_join_partition ( const struct tuple_join_s *p_join, unsigned long long key )
+{
+
+    // Done
+    return ( p_join->bits ) ? (size_t) ( tuple_join_spread(key) >> ( 64 - p_join->bits ) ) : 0;
+}
+
+/** !
+ * Get the bucket an entry key falls in, in a table of 2 ^ table_bits buckets
+ * 
+ * @param p_join     the join
+ * @param key        the entry key
+ * @param table_bits log2 of the quantity of buckets
+ * 
+ * @return the bucket
+ */
+static inline size_t tuple_join_bucket ( const struct tuple_join_s *p_join, unsigned long long key, unsigned int table_bits )
+{
+
+    // Done
+    return ( table_bits ) ? (size_t) ( ( tuple_join_spread(key) << p_join->bits ) >> ( 64 - table_bits ) ) : 0;
+}
+
+/** !
+ * Test a left entry and a right entry for matching keys
+ * 
+ * @param p_join  the join
+ * @param p_left  the left entry
+ * @param p_right the right entry
+ * 
+ * @return true if every key position matches, else false
+ */
+static bool tuple_join_matches ( const struct tuple_join_s *p_join, const struct tuple_join_entry_s *p_left, const struct tuple_join_entry_s *p_right )
+{
+
+    // Different keys, or different hashes
+    if ( p_left->key != p_right->key ) return false;
+
+    // One key position is the element itself
+    if ( p_join->keys == 1 ) return true;
+
+    // Initialized data
+    const tuple *p_a = p_left->p_tuple,
+                *p_b = p_right->p_tuple;
+
+    // Several key positions were hashed together, so compare the elements
+    for (size_t k = 0; k < p_join->keys; k++)
+    {
+
+        // Initialized data. Both positions were checked while partitioning
+        size_t offset_a = 0,
+               offset_b = 0;
+
+        // Get the offsets
+        tuple_offset(p_join->_sides[0].p_keys[k], p_a->element_count, &offset_a);
+        tuple_offset(p_join->_sides[1].p_keys[k], p_b->element_count, &offset_b);
+
+        // Compare
+        if ( tuple_element(p_a, offset_a) != tuple_element(p_b, offset_b) ) return false;
+    }
+
+    // Match
+    return true;
+}
+
+/** !
+ * Compute the entries of a range of blocks on one side, and count the entries in each
+ * partition for each block
+ * 
+ * @param p_context the join
+ * @param begin     first block
+ * @param end       one past the last block
+ * 
+ * @return void
+ */
+static void tuple_join_hash ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_join_s      *p_join = p_context;
+    struct tuple_join_side_s *p_side = &p_join->_sides[p_join->side];
+
+    // Each block
+    for (size_t b = begin; b < end; b++)
+    {
+
+        // Initialized data
+        size_t  first    = b * TUPLE_JOIN_BLOCK,
+                last     = ( p_side->count - first > TUPLE_JOIN_BLOCK ) ? first + TUPLE_JOIN_BLOCK : p_side->count;
+        size_t *p_counts = &p_side->p_counts[b * p_join->partitions];
+
+        // Clear the counts
+        memset(p_counts, 0, p_join->partitions * sizeof(size_t));
+
+        // Each tuple in the block
+        for (size_t i = first; i < last; i++)
+        {
+
+            // Initialized data
+            const tuple               *p_tuple = p_side->pp_tuples[i];
+            struct tuple_join_entry_s *p_entry = &p_side->p_staged[i];
+
+            // Error check
+            if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+            // Compute the key
+            if ( tuple_join_fold(p_join, p_side, p_tuple, &p_entry->key) == 0 ) goto bounds_error;
+
+            // Remember where the tuple is, and how big it is, so counting results doesn't touch it
+            p_entry->p_tuple = p_tuple;
+            p_entry->size    = p_tuple->element_count;
+
+            // Count it
+            p_counts[tuple_join_partition(p_join, p_entry->key)]++;
+        }
+    }
+
+    // Done
+    return;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+
+                // Fail the join
+                atomic_store_explicit(&p_join->status, TUPLE_STATUS_NO_TUPLE, memory_order_relaxed);
+
+                // Error
+                return;
+
+            bounds_error:
+
+                // Fail the join
+                atomic_store_explicit(&p_join->status, TUPLE_STATUS_BOUNDS_ERROR, memory_order_relaxed);
+
+                // Error
+                return;
+        }
+    }
+}
+
+/** !
+ * Move the entries of a range of blocks on one side into their partitions
+ * 
+ * @param p_context the join
+ * @param begin     first block
+ * @param end       one past the last block
+ * 
+ * @return void
+ */
+static void tuple_join_scatter ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_join_s      *p_join = p_context;
+    struct tuple_join_side_s *p_side = &p_join->_sides[p_join->side];
+
+    // Each block
+    for (size_t b = begin; b < end; b++)
+    {
+
+        // Initialized data
+        size_t  first     = b * TUPLE_JOIN_BLOCK,
+                last      = ( p_side->count - first > TUPLE_JOIN_BLOCK ) ? first + TUPLE_JOIN_BLOCK : p_side->count;
+        size_t *p_offsets = &p_side->p_counts[b * p_join->partitions];
+
+        // Each entry, in order, so each partition keeps the order of the tuples
+        for (size_t i = first; i < last; i++)
+            p_side->p_entries[p_offsets[tuple_join_partition(p_join, p_side->p_staged[i].key)]++] = p_side->p_staged[i];
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Get log2 of the quantity of buckets in a partition's table
+ * 
+ * @param p_join    the join
+ * @param partition the partition
+ * 
+ * @return log2 of the quantity of buckets
+ */
+static unsigned int tuple_join_table_bits ( const struct tuple_join_s *p_join, size_t partition )
+{
+
+    // Initialized data
+    size_t       capacity = p_join->p_tables[partition + 1] - p_join->p_tables[partition];
+    unsigned int bits     = 0;
+
+    // The capacity is a power of two
+    while ( ( (size_t) 1 << bits ) < capacity ) bits++;
+
+    // Done
+    return bits;
+}
+
+/** !
+ * Build the hash table of each partition in a range from its right entries, then probe it
+ * with its left entries to count the results, and their elements
+ * 
+ * @param p_context the join
+ * @param begin     first partition
+ * @param end       one past the last partition
+ * 
+ * @return void
+ */
+static void tuple_join_count ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_join_s            *p_join  = p_context;
+    const struct tuple_join_side_s *p_left  = &p_join->_sides[0],
+                                   *p_right = &p_join->_sides[1];
+
+    // Each partition
+    for (size_t p = begin; p < end; p++)
+    {
+
+        // Initialized data
+        size_t       *p_heads    = &p_join->p_heads[p_join->p_tables[p]];
+        size_t        capacity   = p_join->p_tables[p + 1] - p_join->p_tables[p],
+                      outputs    = 0,
+                      elements   = 0;
+        unsigned int  table_bits = tuple_join_table_bits(p_join, p);
+
+        // Empty the buckets
+        memset(p_heads, 0, capacity * sizeof(size_t));
+
+        // Insert the right entries back to front, so each chain lists them front to back
+        for (size_t j = p_right->p_partitions[p + 1]; j-- > p_right->p_partitions[p];)
+        {
+
+            // Initialized data
+            size_t bucket = tuple_join_bucket(p_join, p_right->p_entries[j].key, table_bits);
+
+            // Push the entry onto its chain
+            p_join->p_next[j] = p_heads[bucket];
+            p_heads[bucket]   = j + 1;
+        }
+
+        // Probe with each left entry
+        for (size_t i = p_left->p_partitions[p]; i < p_left->p_partitions[p + 1]; i++)
+        {
+
+            // Initialized data
+            const struct tuple_join_entry_s *p_entry = &p_left->p_entries[i];
+            size_t                           matches = 0;
+
+            // Each right entry in the bucket
+            for (size_t j = p_heads[tuple_join_bucket(p_join, p_entry->key, table_bits)]; j; j = p_join->p_next[j - 1])
+            {
+
+                // Skip entries whose keys differ
+                if ( tuple_join_matches(p_join, p_entry, &p_right->p_entries[j - 1]) == false ) continue;
+
+                // Count the result
+                matches++;
+                elements += p_entry->size + p_right->p_entries[j - 1].size;
+            }
+
+            // A left join keeps a left tuple that matched nothing
+            if ( matches == 0 && p_join->mode == TUPLE_JOIN_LEFT )
+            {
+                matches   = 1;
+                elements += p_entry->size + p_join->pad;
+            }
+
+            // Accumulate
+            outputs += matches;
+        }
+
+        // Store the counts
+        p_join->p_outputs[p]  = outputs;
+        p_join->p_elements[p] = elements;
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Write one result, a left tuple's elements followed by a right tuple's elements, the same
+ * way tuple_concat writes two tuples into one allocation
+ * 
+ * @param p_join    the join
+ * @param p_out     the index of the result, advanced past it
+ * @param pp_cursor where the result goes, advanced past it
+ * @param p_left    the left tuple
+ * @param p_right   the right tuple, or null for padding
+ * 
+ * @return void
+ */
+static void tuple_join_write ( struct tuple_join_s *p_join, size_t *p_out, unsigned char **pp_cursor, const tuple *p_left, const tuple *p_right )
+{
+
+    // Initialized data
+    tuple        *p_result         = (tuple *) *pp_cursor;
+    void *const  *p_left_elements  = tuple_elements(p_left);
+    void *const  *p_right_elements = ( p_right ) ? tuple_elements(p_right) : (void *) 0;
+    size_t        left_size        = p_left->element_count,
+                  right_size       = ( p_right ) ? p_right->element_count : p_join->pad;
+
+    // Error check
+    if ( p_left_elements == (void *) 0 ) goto failed_to_flatten;
+    if ( p_right && p_right_elements == (void *) 0 ) goto failed_to_flatten;
+
+    // Set the header
+    p_result->element_count = left_size + right_size;
+    p_result->_flags        = TUPLE_FLAG_BATCH;
+    atomic_init(&p_result->_references, 1);
+
+    // Copy the left elements
+    memcpy(p_result->_elements, p_left_elements, left_size * sizeof(void *));
+
+    // Copy the right elements ...
+    if ( p_right ) memcpy(&p_result->_elements[left_size], p_right_elements, right_size * sizeof(void *));
+
+    // ... or pad
+    else memset(&p_result->_elements[left_size], 0, right_size * sizeof(void *));
+
+    // Store the handle
+    p_join->p_batch->_p_tuples[( *p_out )++] = p_result;
+
+    // Advance
+    *pp_cursor += sizeof(tuple) + ( left_size + right_size ) * sizeof(void *);
+
+    // Done
+    return;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            failed_to_flatten:
+
+                // Fail the join
+                atomic_store_explicit(&p_join->status, TUPLE_STATUS_NO_MEM, memory_order_relaxed);
+
+                // Error
+                return;
+        }
+    }
+}
+
+/** !
+ * Probe each partition in a range again, and write its results where the counts put them
+ * 
+ * @param p_context the join
+ * @param begin     first partition
+ * @param end       one past the last partition
+ * 
+ * @return void
+ */
+static void tuple_join_emit ( void *const p_context, size_t begin, size_t end )
+{
+
+    // Initialized data
+    struct tuple_join_s            *p_join  = p_context;
+    const struct tuple_join_side_s *p_left  = &p_join->_sides[0],
+                                   *p_right = &p_join->_sides[1];
+
+    // Each partition
+    for (size_t p = begin; p < end; p++)
+    {
+
+        // Initialized data
+        const size_t  *p_heads    = &p_join->p_heads[p_join->p_tables[p]];
+        size_t         out        = p_join->p_outputs[p];
+        unsigned char *p_cursor   = p_join->p_bodies + out * sizeof(tuple) + p_join->p_elements[p] * sizeof(void *);
+        unsigned int   table_bits = tuple_join_table_bits(p_join, p);
+
+        // Probe with each left entry
+        for (size_t i = p_left->p_partitions[p]; i < p_left->p_partitions[p + 1]; i++)
+        {
+
+            // Initialized data
+            const struct tuple_join_entry_s *p_entry = &p_left->p_entries[i];
+            const tuple                     *p_tuple = p_entry->p_tuple;
+            bool                             matched = false;
+
+            // Each right entry in the bucket
+            for (size_t j = p_heads[tuple_join_bucket(p_join, p_entry->key, table_bits)]; j; j = p_join->p_next[j - 1])
+            {
+
+                // Skip entries whose keys differ
+                if ( tuple_join_matches(p_join, p_entry, &p_right->p_entries[j - 1]) == false ) continue;
+
+                // Write the pair
+                tuple_join_write(p_join, &out, &p_cursor, p_tuple, p_right->p_entries[j - 1].p_tuple);
+                matched = true;
+            }
+
+            // A left join keeps a left tuple that matched nothing
+            if ( matched == false && p_join->mode == TUPLE_JOIN_LEFT ) tuple_join_write(p_join, &out, &p_cursor, p_tuple, (void *) 0);
+        }
+    }
+
+    // Done
+    return;
+}
+
+/** !
+ * Run a pass of a join, on the worker pool if the join is parallel
+ * 
+ * @param p_join    the join
+ * @param pfn_range the pass
+ * @param length    quantity of blocks or partitions
+ * 
+ * @return void
+ */
+static void tuple_join_run ( struct tuple_join_s *p_join, void (*pfn_range)(void *const p_context, size_t begin, size_t end), size_t length )
+{
+
+    // On the pool ...
+    if ( p_join->parallel ) tuple_parallel_for(pfn_range, p_join, length, 1);
+
+    // ... or right here
+    else pfn_range(p_join, 0, length);
+
+    // Done
+    return;
+}
+
+/** !
+ * Radix partition one side of a join on the top bits of its spread keys
+ * 
+ * @param p_join the join
+ * @param side   0 for the left side, 1 for the right side
+ * 
+ * @return 1 on success, 0 if memory could not be allocated. A missing or short tuple sets the join's status
+ */
+static int tuple_join_split ( struct tuple_join_s *p_join, size_t side )
+{
+
+    // Initialized data
+    struct tuple_join_side_s *p_side = &p_join->_sides[side];
+    size_t                    slots  = ( p_side->count ) ? p_side->count : 1,
+                              offset = 0;
+
+    // Blocks of tuples
+    p_side->blocks = ( p_side->count + TUPLE_JOIN_BLOCK - 1 ) / TUPLE_JOIN_BLOCK;
+
+    // Overflow check
+    if ( slots > (size_t) -1 / sizeof(struct tuple_join_entry_s) ) return 0;
+
+    // Allocate the entries, twice, and the per block and per partition offsets
+    p_side->p_staged     = TUPLE_REALLOC(0, slots * sizeof(struct tuple_join_entry_s));
+    p_side->p_entries    = TUPLE_REALLOC(0, slots * sizeof(struct tuple_join_entry_s));
+    p_side->p_counts     = TUPLE_REALLOC(0, ( ( p_side->blocks ) ? p_side->blocks : 1 ) * p_join->partitions * sizeof(size_t));
+    p_side->p_partitions = TUPLE_REALLOC(0, ( p_join->partitions + 1 ) * sizeof(size_t));
+
+    // Error check
+    if ( p_side->p_staged     == (void *) 0 ) return 0;
+    if ( p_side->p_entries    == (void *) 0 ) return 0;
+    if ( p_side->p_counts     == (void *) 0 ) return 0;
+    if ( p_side->p_partitions == (void *) 0 ) return 0;
+
+    // Compute every entry, and count each block's partitions
+    p_join->side = side;
+    tuple_join_run(p_join, tuple_join_hash, p_side->blocks);
+
+    // A tuple is missing, or too short for a key
+    if ( atomic_load_explicit(&p_join->status, memory_order_relaxed) != TUPLE_STATUS_OK ) return 1;
+
+    // Each block writes each partition after every earlier partition, and after the same partition from earlier blocks
+    for (size_t q = 0; q < p_join->partitions; q++)
+    {
+
+        // The partition starts here
+        p_side->p_partitions[q] = offset;
+
+        // Each block's share of it
+        for (size_t b = 0; b < p_side->blocks; b++)
+        {
+
+            // Initialized data
+            size_t quantity = p_side->p_counts[b * p_join->partitions + q];
+
+            // Turn the count into an offset
+            p_side->p_counts[b * p_join->partitions + q] = offset;
+            offset += quantity;
+        }
+    }
+
+    // The last partition ends here
+    p_side->p_partitions[p_join->partitions] = offset;
+
+    // Scatter
+    tuple_join_run(p_join, tuple_join_scatter, p_side->blocks);
+
+    // The staged entries and the block offsets are done with
+    p_side->p_staged = TUPLE_REALLOC(p_side->p_staged, 0);
+    p_side->p_counts = TUPLE_REALLOC(p_side->p_counts, 0);
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Free everything a join allocated, except results that were handed to the caller
+ * 
+ * @param p_join the join
+ * 
+ * @return void
+ */
+static void tuple_join_free ( struct tuple_join_s *p_join )
+{
+
+    // Each side
+    for (size_t i = 0; i < 2; i++)
+    {
+
+        // Initialized data
+        struct tuple_join_side_s *p_side = &p_join->_sides[i];
+
+        // Free the side
+        if ( p_side->p_staged     ) p_side->p_staged     = TUPLE_REALLOC(p_side->p_staged, 0);
+        if ( p_side->p_entries    ) p_side->p_entries    = TUPLE_REALLOC(p_side->p_entries, 0);
+        if ( p_side->p_counts     ) p_side->p_counts     = TUPLE_REALLOC(p_side->p_counts, 0);
+        if ( p_side->p_partitions ) p_side->p_partitions = TUPLE_REALLOC(p_side->p_partitions, 0);
+    }
+
+    // Free the tables, the counts, and the results
+    if ( p_join->p_tables   ) p_join->p_tables   = TUPLE_REALLOC(p_join->p_tables, 0);
+    if ( p_join->p_heads    ) p_join->p_heads    = TUPLE_REALLOC(p_join->p_heads, 0);
+    if ( p_join->p_next     ) p_join->p_next     = TUPLE_REALLOC(p_join->p_next, 0);
+    if ( p_join->p_outputs  ) p_join->p_outputs  = TUPLE_REALLOC(p_join->p_outputs, 0);
+    if ( p_join->p_elements ) p_join->p_elements = TUPLE_REALLOC(p_join->p_elements, 0);
+    if ( p_join->p_batch    ) p_join->p_batch    = TUPLE_REALLOC(p_join->p_batch, 0);
+
+    // Done
+    return;
+}
+
+int tuple_join ( const tuple *const *const pp_left, size_t left_count, const tuple *const *const pp_right, size_t right_count, const signed long long *const left_keys, const signed long long *const right_keys, size_t key_count, tuple_join_mode mode, bool parallel, tuple ***const ppp_results, size_t *const p_count )
+{
+
+    // Argument check
+    if ( pp_left     == (void *) 0 && left_count  ) goto no_elements;
+    if ( pp_right    == (void *) 0 && right_count ) goto no_elements;
+    if ( left_keys   == (void *) 0 ) goto no_keys;
+    if ( right_keys  == (void *) 0 ) goto no_keys;
+    if ( key_count   == 0 )          goto no_keys;
+    if ( mode != TUPLE_JOIN_INNER && mode != TUPLE_JOIN_LEFT ) goto bad_mode;
+    if ( ppp_results == (void *) 0 ) goto no_result;
+    if ( p_count     == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    size_t              buckets  = 0,
+                        outputs  = 0,
+                        elements = 0;
+    int                 status   = TUPLE_STATUS_OK;
+    struct tuple_join_s join     = 
+    {
+        ._sides   =
+        {
+            { .pp_tuples = pp_left , .count = left_count , .p_keys = left_keys  },
+            { .pp_tuples = pp_right, .count = right_count, .p_keys = right_keys }
+        },
+        .keys     = key_count,
+        .mode     = mode,
+        .parallel = parallel
+    };
+
+    // A left tuple that matches nothing is padded to the size of the first right tuple
+    if ( mode == TUPLE_JOIN_LEFT && right_count )
+    {
+
+        // Argument check
+        if ( pp_right[0] == (void *) 0 ) goto no_tuple;
+
+        // Store the padding
+        join.pad = pp_right[0]->element_count;
+    }
+
+    // Enough partitions that each one holds about TUPLE_JOIN_PARTITION right tuples
+    while ( join.bits < TUPLE_JOIN_BITS_MAX && ( right_count >> join.bits ) > TUPLE_JOIN_PARTITION ) join.bits++;
+    join.partitions = (size_t) 1 << join.bits;
+
+    // Nothing has failed yet
+    atomic_init(&join.status, TUPLE_STATUS_OK);
+
+    // Partition the right side, then the left side
+    if ( tuple_join_split(&join, 1) == 0 ) goto failed_to_allocate;
+    if ( atomic_load_explicit(&join.status, memory_order_relaxed) == TUPLE_STATUS_OK && tuple_join_split(&join, 0) == 0 ) goto failed_to_allocate;
+
+    // Error check
+    status = atomic_load_explicit(&join.status, memory_order_relaxed);
+    if ( status != TUPLE_STATUS_OK ) goto failed_to_join;
+
+    // Allocate the per partition bookkeeping
+    join.p_tables   = TUPLE_REALLOC(0, ( join.partitions + 1 ) * sizeof(size_t));
+    join.p_outputs  = TUPLE_REALLOC(0, join.partitions * sizeof(size_t));
+    join.p_elements = TUPLE_REALLOC(0, join.partitions * sizeof(size_t));
+    join.p_next     = TUPLE_REALLOC(0, ( ( right_count ) ? right_count : 1 ) * sizeof(size_t));
+
+    // Error check
+    if ( join.p_tables   == (void *) 0 ) goto failed_to_allocate;
+    if ( join.p_outputs  == (void *) 0 ) goto failed_to_allocate;
+    if ( join.p_elements == (void *) 0 ) goto failed_to_allocate;
+    if ( join.p_next     == (void *) 0 ) goto failed_to_allocate;
+
+    // Lay every partition's buckets back to back, a power of two at least as many as its right tuples
+    for (size_t p = 0; p < join.partitions; p++)
+    {
+
+        // Initialized data
+        size_t rows     = join._sides[1].p_partitions[p + 1] - join._sides[1].p_partitions[p],
+               capacity = 1;
+
+        // Round up
+        while ( capacity < rows ) capacity <<= 1;
+
+        // The partition's buckets start here
+        join.p_tables[p] = buckets;
+        buckets += capacity;
+    }
+
+    // The last partition's buckets end here
+    join.p_tables[join.partitions] = buckets;
+
+    // Allocate the buckets
+    join.p_heads = TUPLE_REALLOC(0, buckets * sizeof(size_t));
+
+    // Error check
+    if ( join.p_heads == (void *) 0 ) goto failed_to_allocate;
+
+    // Build each partition's table, and count its results
+    tuple_join_run(&join, tuple_join_count, join.partitions);
+
+    // Turn the counts into offsets
+    for (size_t p = 0; p < join.partitions; p++)
+    {
+
+        // Initialized data
+        size_t partition_outputs  = join.p_outputs[p],
+               partition_elements = join.p_elements[p];
+
+        // Overflow check
+        if ( partition_elements > (size_t) -1 - elements ) goto failed_to_allocate;
+
+        // The partition's results start here
+        join.p_outputs[p]  = outputs;
+        join.p_elements[p] = elements;
+
+        // Accumulate
+        outputs  += partition_outputs;
+        elements += partition_elements;
+    }
+
+    // Overflow check
+    if ( outputs  > ( (size_t) -1 / 2 ) / ( sizeof(tuple *) + sizeof(tuple) ) ) goto failed_to_allocate;
+    if ( elements > ( (size_t) -1 / 2 ) / sizeof(void *) ) goto failed_to_allocate;
+
+    // One block for the handles, every header, and every element, like tuple_from_elements_batch
+    join.p_batch = TUPLE_REALLOC(0, sizeof(struct tuple_batch_s) + outputs * ( sizeof(tuple *) + sizeof(tuple) ) + elements * sizeof(void *));
+
+    // Error check
+    if ( join.p_batch == (void *) 0 ) goto failed_to_allocate;
+
+    // Store the quantity of results
+    join.p_batch->count = outputs;
+
+    // The results start after the handles
+    join.p_bodies = (unsigned char *) &join.p_batch->_p_tuples[outputs];
+
+    // Write the results
+    tuple_join_run(&join, tuple_join_emit, join.partitions);
+
+    // Error check
+    status = atomic_load_explicit(&join.status, memory_order_relaxed);
+    if ( status != TUPLE_STATUS_OK ) goto failed_to_join;
+
+    // Return the results to the caller
+    *ppp_results = join.p_batch->_p_tuples;
+    *p_count     = outputs;
+
+    // The caller owns the results
+    join.p_batch = (void *) 0;
+
+    // Clean up
+    tuple_join_free(&join);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"pp_left\" or \"pp_right\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_keys:
+                TUPLE_ERROR(TUPLE_STATUS_NO_KEYS, "[tuple] Null pointer, or no keys, provided for parameter \"left_keys\" or \"right_keys\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bad_mode:
+                TUPLE_ERROR(TUPLE_STATUS_BAD_JOIN, "[tuple] Parameter \"mode\" is not a join mode in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"ppp_results\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null tuple in parameter \"pp_right\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            failed_to_join:
+
+                // Free everything
+                tuple_join_free(&join);
+
+                // A tuple is missing ...
+                if ( status == TUPLE_STATUS_NO_TUPLE )
+                    TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null tuple in parameter \"pp_left\" or \"pp_right\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // ... or too short for a key ...
+                else if ( status == TUPLE_STATUS_BOUNDS_ERROR )
+                    TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Key index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // ... or could not be flattened
+                else
+                    TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_allocate:
+
+                // Free everything
+                tuple_join_free(&join);
+
+                // Report
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_pool_attach ( tuple_pool *const p_pool )
+{
+
+    // Initialized data
+    struct tuple_pool_cache_s *p_cache = &tuple_pool_cache;
+
+    // Fast exit
+    if ( p_cache->p_pool == p_pool ) return 1;
+
+    // Give every cached block back to the previous pool
+    if ( p_cache->p_pool )
+    {
+
+        // Drop stale blocks
+        tuple_pool_cache_validate(p_cache);
+
+        // Flush each size class
+        for (size_t i = 0; i < TUPLE_POOL_CLASSES; i++)
+            if ( p_cache->_count[i] ) tuple_pool_cache_flush(p_cache, i, p_cache->_count[i]);
+    }
+
+    // Attach the new pool
+    p_cache->p_pool     = p_pool;
+    p_cache->generation = ( p_pool ) ? atomic_load_explicit(&p_pool->generation, memory_order_acquire) : 0;
+
+    // Flush the cache if the thread exits attached
+    #ifndef _WIN64
+        pthread_setspecific(tuple_pool_key, ( p_pool ) ? p_cache : (void *) 0);
+    #endif
+
+    // Success
+    return 1;
+}
+
+int tuple_pool_reset ( tuple_pool *const p_pool )
+{
+
+    // Argument check
+    if ( p_pool == (void *) 0 ) goto no_pool;
+
+    // Lock
+    mutex_lock(&p_pool->_lock);
+
+    // Release every slab
+    while ( p_pool->p_slabs )
+    {
+
+        // Initialized data
+        struct tuple_pool_slab_s *p_slab = p_pool->p_slabs;
+
+        // Advance
+        p_pool->p_slabs = p_slab->p_next;
+
+        // Free the slab
+        p_slab = TUPLE_REALLOC(p_slab, 0);
+    }
+
+    // Clear the free lists and the active slabs
+    memset(p_pool->_p_free  , 0, sizeof(p_pool->_p_free));
+    memset(p_pool->_p_cursor, 0, sizeof(p_pool->_p_cursor));
+    memset(p_pool->_p_end   , 0, sizeof(p_pool->_p_end));
+
+    // Invalidate every thread's cached blocks
+    atomic_fetch_add_explicit(&p_pool->generation, 1, memory_order_release);
+
+    // Unlock
+    mutex_unlock(&p_pool->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pool:
+                TUPLE_ERROR(TUPLE_STATUS_NO_POOL, "[tuple] Null pointer provided for parameter \"p_pool\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_arena_attach ( tuple_arena *const p_arena )
+{
+
+    // Attach the arena, or detach with null
+    p_tuple_arena = p_arena;
+
+    // Success
+    return 1;
+}
+
+int tuple_arena_reset ( tuple_arena *const p_arena )
+{
+
+    // Argument check
+    if ( p_arena == (void *) 0 ) goto no_arena;
+
+    // Rewind to the first chunk. Chunks are kept for reuse
+    p_arena->p_chunk  = (void *) 0;
+    p_arena->p_cursor = (void *) 0;
+    p_arena->p_end    = (void *) 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ARENA, "[tuple] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Rebuild a stripe's slots at a new capacity, dropping tombstones. The caller holds the
+ * stripe's lock
+ * 
+ * @param p_stripe the stripe
+ * @param capacity the new quantity of slots, a power of two
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int tuple_intern_resize ( struct tuple_intern_stripe_s *p_stripe, size_t capacity )
+{
+
+    // Initialized data
+    struct tuple_intern_slot_s *p_slots = TUPLE_REALLOC(0, capacity * sizeof(struct tuple_intern_slot_s));
+
+    // Error check
+    if ( p_slots == (void *) 0 ) return 0;
+
+    // Zero set
+    memset(p_slots, 0, capacity * sizeof(struct tuple_intern_slot_s));
+
+    // Move each live tuple
+    for (size_t i = 0; i < p_stripe->capacity; i++)
+    {
+
+        // Initialized data
+        struct tuple_intern_slot_s *p_slot = &p_stripe->_p_slots[i];
+
+        // Skip empty slots and tombstones
+        if ( p_slot->p_tuple == (void *) 0 || p_slot->p_tuple == (tuple *) p_stripe ) continue;
+
+        // Find an empty slot
+        for (size_t j = (size_t) p_slot->hash & ( capacity - 1 );; j = ( j + 1 ) & ( capacity - 1 ))
+            if ( p_slots[j].p_tuple == (void *) 0 ) { p_slots[j] = *p_slot; break; }
+    }
+
+    // Swap the slots
+    if ( p_stripe->_p_slots ) p_stripe->_p_slots = TUPLE_REALLOC(p_stripe->_p_slots, 0);
+    p_stripe->_p_slots  = p_slots;
+    p_stripe->capacity  = capacity;
+    p_stripe->used      = p_stripe->count;
+
+    // Success
+    return 1;
+}
+
+int tuple_intern ( tuple_intern_table *const p_table, void *const *const elements, size_t size, tuple **const pp_tuple )
+{
+
+    // Argument check
+    if ( p_table  == (void *) 0 ) goto no_table;
+    if ( elements == (void *) 0 ) goto no_elements;
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    unsigned long long            hash     = tuple_hash_elements(elements, size, p_table->pfn_element_hash);
+    struct tuple_intern_stripe_s *p_stripe = &p_table->_stripes[hash >> 58];
+    struct tuple_intern_slot_s   *p_free   = (void *) 0;
+    tuple                        *p_tuple  = (void *) 0;
+    tuple_arena                  *p_arena  = p_tuple_arena;
+    tuple_pool                   *p_pool   = tuple_pool_cache.p_pool;
+
+    // Lock
+    mutex_lock(&p_stripe->_lock);
+
+    // Keep the load under three quarters, counting tombstones
+    if ( ( p_stripe->used + 1 ) * 4 > p_stripe->capacity * 3 )
+    {
+
+        // Initialized data
+        size_t capacity = TUPLE_INTERN_CAPACITY;
+
+        // At least twice the live tuples. A stripe full of tombstones is rebuilt at its size
+        while ( capacity < ( p_stripe->count + 1 ) * 2 ) capacity *= 2;
+
+        // Rebuild
+        if ( tuple_intern_resize(p_stripe, capacity) == 0 ) goto no_mem_locked;
+    }
+
+    // Probe
+    for (size_t i = (size_t) hash & ( p_stripe->capacity - 1 );; i = ( i + 1 ) & ( p_stripe->capacity - 1 ))
+    {
+
+        // Initialized data
+        struct tuple_intern_slot_s *p_slot = &p_stripe->_p_slots[i];
+
+        // Not present
+        if ( p_slot->p_tuple == (void *) 0 )
+        {
+
+            // Prefer the first tombstone passed
+            if ( p_free == (void *) 0 ) p_free = p_slot;
+
+            // Done probing
+            break;
+        }
+
+        // Remember the first tombstone
+        if ( p_slot->p_tuple == (tuple *) p_stripe ) { if ( p_free == (void *) 0 ) p_free = p_slot; continue; }
+
+        // Found the canonical tuple
+        if ( p_slot->hash == hash && tuple_equals_elements(p_slot->p_tuple->_elements, p_slot->p_tuple->element_count, elements, size, p_table->pfn_compare) )
+        {
+
+            // The caller gets a reference
+            p_tuple = p_slot->p_tuple;
+            atomic_fetch_add_explicit(&p_tuple->_references, 1, memory_order_relaxed);
+
+            // Done
+            goto done;
+        }
+    }
+
+    // Canonical tuples outlive any arena or pool reset, so construct from the heap
+    p_tuple_arena           = (void *) 0;
+    tuple_pool_cache.p_pool = (void *) 0;
+    p_tuple                 = tuple_allocate(size);
+    tuple_pool_cache.p_pool = p_pool;
+    p_tuple_arena           = p_arena;
+
+    // Error check
+    if ( p_tuple == (void *) 0 ) goto no_mem_locked;
+
+    // Copy the elements
+    memcpy(p_tuple->_elements, elements, size * sizeof(void *));
+
+    // The identity hash is already known
+    if ( p_table->pfn_element_hash == (void *) 0 ) atomic_store_explicit(tuple_hash_slot(p_tuple), tuple_hash_identity(hash), memory_order_relaxed);
+
+    // One reference for the table, one for the caller
+    atomic_store_explicit(&p_tuple->_references, 2, memory_order_relaxed);
+
+    // Insert
+    if ( p_free->p_tuple == (void *) 0 ) p_stripe->used++;
+    p_free->hash    = hash;
+    p_free->p_tuple = p_tuple;
+    p_stripe->count++;
+
+    done:
+
+    // Unlock
+    mutex_unlock(&p_stripe->_lock);
+
+    // Return the canonical tuple
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem_locked:
+
+                // Unlock
+                mutex_unlock(&p_stripe->_lock);
+
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_intern_collect ( tuple_intern_table *const p_table )
+{
+
+    // Argument check
+    if ( p_table == (void *) 0 ) goto no_table;
+
+    // Sweep each stripe
+    for (size_t i = 0; i < TUPLE_INTERN_STRIPES; i++)
+    {
+
+        // Initialized data
+        struct tuple_intern_stripe_s *p_stripe = &p_table->_stripes[i];
+
+        // Lock. Lookups take a reference under this lock, so a count of 1 is stable
+        mutex_lock(&p_stripe->_lock);
+
+        // Drop every tuple only the table holds
+        for (size_t j = 0; j < p_stripe->capacity; j++)
+        {
+
+            // Initialized data
+            struct tuple_intern_slot_s *p_slot = &p_stripe->_p_slots[j];
+
+            // Skip empty slots, tombstones, and tuples still in use
+            if ( p_slot->p_tuple == (void *) 0 || p_slot->p_tuple == (tuple *) p_stripe ) continue;
+            if ( atomic_load_explicit(&p_slot->p_tuple->_references, memory_order_acquire) != 1 ) continue;
+
+            // Release the table's reference, and leave a tombstone
+            tuple_unreference(p_slot->p_tuple);
+            p_slot->p_tuple = (tuple *) p_stripe;
+            p_stripe->count--;
+        }
+
+        // Unlock
+        mutex_unlock(&p_stripe->_lock);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Double a table's capacity, spreading the columns out to their new offsets
+ * 
+ * @param p_table the table
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int tuple_table_grow ( tuple_table *p_table )
+{
+
+    // Initialized data
+    size_t   capacity = ( p_table->capacity ) ? p_table->capacity * 2 : TUPLE_TABLE_CAPACITY;
+    void   **p_data   = (void *) 0;
+
+    // Rows of no elements need no columns
+    if ( p_table->arity == 0 ) goto done;
+
+    // Grow the block
+    p_data = TUPLE_REALLOC(p_table->_p_data, p_table->arity * capacity * sizeof(void *));
+
+    // Error check
+    if ( p_data == (void *) 0 ) return 0;
+
+    // Move each column to its new offset, last first, so no column is overwritten before it moves
+    for (size_t c = p_table->arity - 1; c > 0; c--)
+        memmove(&p_data[c * capacity], &p_data[c * p_table->capacity], p_table->rows * sizeof(void *));
+
+    // Store the block
+    p_table->_p_data = p_data;
+
+    done:
+
+    // Store the capacity
+    p_table->capacity = capacity;
+
+    // Success
+    return 1;
+}
+
+int tuple_table_append ( tuple_table *const p_table, void *const *const elements, size_t *const p_row )
+{
+
+    // Argument check
+    if ( p_table  == (void *) 0 ) goto no_table;
+    if ( elements == (void *) 0 && p_table->arity ) goto no_elements;
+
+    // Make room
+    if ( p_table->rows == p_table->capacity )
+        if ( tuple_table_grow(p_table) == 0 ) goto no_mem;
+
+    // Write each element to the end of its column
+    for (size_t c = 0; c < p_table->arity; c++)
+        p_table->_p_data[c * p_table->capacity + p_table->rows] = elements[c];
+
+    // Return the row's index
+    if ( p_row ) *p_row = p_table->rows;
+
+    // Count the row
+    p_table->rows++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_table_append_tuple ( tuple_table *const p_table, const tuple *const p_tuple, size_t *const p_row )
+{
+
+    // Argument check
+    if ( p_table == (void *) 0 ) goto no_table;
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( p_tuple->element_count != p_table->arity ) goto arity_mismatch;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_tuple);
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Success
+    return tuple_table_append(p_table, p_elements, p_row);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            arity_mismatch:
+                TUPLE_ERROR(TUPLE_STATUS_ARITY_MISMATCH, "[tuple] Parameter \"p_tuple\" has %zu elements, table rows have %zu, in call to function \"%s\"\n", p_tuple->element_count, p_table->arity, __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_table_row ( const tuple_table *const p_table, signed long long row, tuple_row *const p_row )
+{
+
+    // Argument check
+    if ( p_table == (void *) 0 ) goto no_table;
+    if ( p_row   == (void *) 0 ) goto no_row;
+
+    // Initialized data
+    size_t offset = 0;
+
+    // Bounds check
+    if ( tuple_offset(row, p_table->rows, &offset) == 0 ) goto bounds_error;
+
+    // Return the handle
+    *p_row = (tuple_row) { .p_table = p_table, .row = offset };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_row:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ROW, "[tuple] Null pointer provided for parameter \"p_row\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Row out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void *const *tuple_table_column ( const tuple_table *const p_table, size_t column )
+{
+
+    // Argument check
+    if ( p_table == (void *) 0 ) goto no_table;
+    if ( column >= p_table->arity ) goto bounds_error;
+
+    // Success
+    return &p_table->_p_data[column * p_table->capacity];
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return (void *) 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Column out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+size_t tuple_table_size ( const tuple_table *const p_table )
+{
+
+    // Argument check
+    if ( p_table == (void *) 0 ) goto no_table;
+
+    // Success
+    return p_table->rows;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t tuple_table_arity ( const tuple_table *const p_table )
+{
+
+    // Argument check
+    if ( p_table == (void *) 0 ) goto no_table;
+
+    // Success
+    return p_table->arity;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"p_table\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_row_index ( const tuple_row *const p_row, signed long long index, void **const pp_value )
+{
+
+    // Argument check
+    if ( p_row    == (void *) 0 ) goto no_row;
+    if ( pp_value == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    const tuple_table *p_table = p_row->p_table;
+    size_t             offset  = 0;
+
+    // State check
+    if ( p_table->arity == 0 ) goto no_elements;
+
+    // Bounds check
+    if ( tuple_offset(index, p_table->arity, &offset) == 0 ) goto bounds_error;
+
+    // Return the element, from its column
+    *pp_value = p_table->_p_data[offset * p_table->capacity + p_row->row];
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_row:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ROW, "[tuple] Null pointer provided for parameter \"p_row\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_EMPTY, "[tuple] Table rows have no elements in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_row_slice ( const tuple_row *const p_row, const void **const pp_elements, signed long long lower_bound, signed long long upper_bound )
+{
+
+    // Argument check
+    if ( p_row       == (void *) 0 ) goto no_row;
+    if ( pp_elements == (void *) 0 ) goto no_pp_elements;
+    if ( lower_bound <  0 ) goto erroneous_lower_bound;
+    if ( upper_bound <  lower_bound || (size_t) upper_bound >= p_row->p_table->arity ) goto erroneous_upper_bound;
+
+    // Initialized data
+    const tuple_table *p_table = p_row->p_table;
+
+    // Gather the elements from their columns
+    for (size_t c = (size_t) lower_bound; c <= (size_t) upper_bound; c++)
+        pp_elements[c - (size_t) lower_bound] = p_table->_p_data[c * p_table->capacity + p_row->row];
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_row:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ROW, "[tuple] Null pointer provided for parameter \"p_row\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_pp_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            erroneous_lower_bound:
+                TUPLE_ERROR(TUPLE_STATUS_LOWER_BOUND, "[tuple] Parameter \"lower_bound\" must be greater than or equal to zero in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            erroneous_upper_bound:
+                TUPLE_ERROR(TUPLE_STATUS_UPPER_BOUND, "[tuple] Parameter \"upper_bound\" must be between \"lower_bound\" and the last element in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_row_to_tuple ( const tuple_row *const p_row, tuple **const pp_tuple )
+{
+
+    // Argument check
+    if ( p_row    == (void *) 0 ) goto no_row;
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    const tuple_table *p_table = p_row->p_table;
+    tuple             *p_tuple = tuple_allocate(p_table->arity);
+
+    // Error check
+    if ( p_tuple == (void *) 0 ) goto no_mem;
+
+    // Gather the elements from their columns
+    for (size_t c = 0; c < p_table->arity; c++)
+        p_tuple->_elements[c] = p_table->_p_data[c * p_table->capacity + p_row->row];
+
+    // Return the tuple
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_row:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ROW, "[tuple] Null pointer provided for parameter \"p_row\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Grow a builder's buffer geometrically until it has room for at least needed elements
+ * 
+ * @param p_builder the builder
+ * @param needed    the quantity of elements the buffer must hold
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int tuple_builder_reserve ( tuple_builder *p_builder, size_t needed )
+{
+
+    // Initialized data
+    size_t  capacity = ( p_builder->capacity ) ? p_builder->capacity : TUPLE_BUILDER_CAPACITY;
+    size_t  size     = ( p_builder->p_tuple ) ? p_builder->p_tuple->element_count : 0;
+    tuple  *p_tuple  = (void *) 0;
+
+    // Already big enough
+    if ( p_builder->p_tuple && needed <= p_builder->capacity ) return 1;
+
+    // Overflow check
+    if ( needed > ( ( (size_t) -1 - sizeof(tuple) ) / sizeof(void *) ) ) return 0;
+
+    // Double until it fits, or until doubling would overflow
+    while ( capacity < needed )
+        capacity = ( capacity > ( ( (size_t) -1 - sizeof(tuple) ) / sizeof(void *) ) / 2 ) ? needed : capacity * 2;
+
+    // Grow the buffer
+    p_tuple = TUPLE_REALLOC(p_builder->p_tuple, sizeof(tuple) + capacity * sizeof(void *));
+
+    // Error check
+    if ( p_tuple == (void *) 0 ) return 0;
+
+    // A new buffer holds nothing, and a moved one holds what it did
+    p_tuple->element_count = size;
+
+    // Store the buffer
+    p_builder->p_tuple  = p_tuple;
+    p_builder->capacity = capacity;
+
+    // Success
+    return 1;
+}
+
+int tuple_builder_push ( tuple_builder *const p_builder, void *const value )
+{
+
+    // Argument check
+    if ( p_builder == (void *) 0 ) goto no_builder;
+
+    // Initialized data
+    tuple  *p_tuple = p_builder->p_tuple;
+    size_t  size    = ( p_tuple ) ? p_tuple->element_count : 0;
+
+    // Make room, when the buffer is full or was taken by a freeze
+    if ( TUPLE_UNLIKELY(p_tuple == (void *) 0 || size == p_builder->capacity) )
+    {
+
+        // Grow
+        if ( tuple_builder_reserve(p_builder, size + 1) == 0 ) goto no_mem;
+
+        // The buffer may have moved
+        p_tuple = p_builder->p_tuple;
+    }
+
+    // Append the element. Null is a value like any other
+    p_tuple->_elements[size] = value;
+
+    // Count it
+    p_tuple->element_count = size + 1;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_builder:
+                TUPLE_ERROR(TUPLE_STATUS_NO_BUILDER, "[tuple] Null pointer provided for parameter \"p_builder\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_builder_push_n ( tuple_builder *const p_builder, void *const *const elements, size_t count )
+{
+
+    // Argument check
+    if ( p_builder == (void *) 0 ) goto no_builder;
+    if ( elements  == (void *) 0 && count ) goto no_elements;
+
+    // Initialized data
+    size_t size = ( p_builder->p_tuple ) ? p_builder->p_tuple->element_count : 0;
+
+    // Overflow check
+    if ( count > (size_t) -1 - size ) goto no_mem;
+
+    // Make room
+    if ( tuple_builder_reserve(p_builder, size + count) == 0 ) goto no_mem;
+
+    // Append the elements
+    if ( count ) memcpy(&p_builder->p_tuple->_elements[size], elements, count * sizeof(void *));
+
+    // Count them
+    p_builder->p_tuple->element_count = size + count;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_builder:
+                TUPLE_ERROR(TUPLE_STATUS_NO_BUILDER, "[tuple] Null pointer provided for parameter \"p_builder\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_elements:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ELEMENTS, "[tuple] Null pointer provided for parameter \"elements\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t tuple_builder_size ( const tuple_builder *const p_builder )
+{
+
+    // Argument check
+    if ( p_builder == (void *) 0 ) goto no_builder;
+
+    // Success
+    return ( p_builder->p_tuple ) ? p_builder->p_tuple->element_count : 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_builder:
+                TUPLE_ERROR(TUPLE_STATUS_NO_BUILDER, "[tuple] Null pointer provided for parameter \"p_builder\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_builder_freeze ( tuple_builder *const p_builder, tuple **const pp_tuple )
+{
+
+    // Argument check
+    if ( p_builder == (void *) 0 ) goto no_builder;
+    if ( pp_tuple  == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    tuple *p_tuple = (void *) 0;
+
+    // A builder that was already frozen starts a new, empty buffer
+    if ( tuple_builder_reserve(p_builder, 0) == 0 ) goto no_mem;
+
+    // Take the buffer
+    p_tuple = p_builder->p_tuple;
+
+    // Give back the spare capacity. Shrinking does not move the elements, and if it fails, the
+    // tuple keeps the larger block
+    if ( p_builder->capacity > p_tuple->element_count )
+    {
+
+        // Initialized data
+        tuple *p_shrunk = TUPLE_REALLOC(p_tuple, sizeof(tuple) + p_tuple->element_count * sizeof(void *));
+
+        // Keep the smaller block, and start the next buffer at this size
+        if ( p_shrunk )
+        {
+            p_tuple             = p_shrunk;
+            p_builder->capacity = p_tuple->element_count;
+        }
+    }
+
+    // The buffer becomes a heap tuple, owned by the caller
+    p_tuple->_flags = 0;
+    atomic_init(&p_tuple->_references, 1);
+
+    // The builder no longer has a buffer. Its capacity is kept, so the next buffer starts out
+    // big enough for a tuple like this one
+    p_builder->p_tuple = (void *) 0;
+
+    // Return the tuple
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_builder:
+                TUPLE_ERROR(TUPLE_STATUS_NO_BUILDER, "[tuple] Null pointer provided for parameter \"p_builder\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Append a stage to a pipeline
+ * 
+ * @param p_pipeline    the pipeline
+ * @param pfn_map       the stage's map, or null
+ * @param pfn_predicate the stage's filter, or null
+ * 
+ * @return 1 on success, 0 if the stages could not grow
+ */
+static int tuple_pipeline_append ( tuple_pipeline *p_pipeline, void *(*pfn_map)(void *const value, size_t index), bool (*pfn_predicate)(void *const value, size_t index) )
+{
+
+    // Grow
+    if ( p_pipeline->count == p_pipeline->capacity )
+    {
+
+        // Initialized data
+        struct tuple_stage_s *p_stages = TUPLE_REALLOC(p_pipeline->_p_stages, p_pipeline->capacity * 2 * sizeof(struct tuple_stage_s));
+
+        // Error check
+        if ( p_stages == (void *) 0 ) return 0;
+
+        // Store the larger array
+        p_pipeline->_p_stages  = p_stages;
+        p_pipeline->capacity  *= 2;
+    }
+
+    // Store the stage
+    p_pipeline->_p_stages[p_pipeline->count++] = (struct tuple_stage_s)
+    {
+        .pfn_map       = pfn_map,
+        .pfn_predicate = pfn_predicate
+    };
+
+    // Success
+    return 1;
+}
+
+/** !
+ * Run a block of elements through every stage of a pipeline. Each stage runs over the whole
+ * block before the next one starts, so each callback is called from its own loop, and the
+ * block stays in cache between stages
+ * 
+ * @param p_pipeline the pipeline
+ * @param p_values   count elements, and return the elements the last stage produced
+ * @param p_indices  each element's index in the source. Filters compact these with the elements
+ * @param count      quantity of elements in the block
+ * 
+ * @return quantity of elements every filter kept, at the front of p_values
+ */
+static size_t tuple_pipeline_run ( const tuple_pipeline *p_pipeline, void **p_values, size_t *p_indices, size_t count )
+{
+
+    // Each stage, in order
+    for (size_t i = 0; i < p_pipeline->count && count; i++)
+    {
+
+        // Initialized data
+        void *(*pfn_map)(void *const value, size_t index)       = p_pipeline->_p_stages[i].pfn_map;
+        bool  (*pfn_predicate)(void *const value, size_t index) = p_pipeline->_p_stages[i].pfn_predicate;
+        size_t  kept                                             = 0;
+
+        // Map every element in place
+        if ( pfn_map )
+        {
+            for (size_t j = 0; j < count; j++) p_values[j] = pfn_map(p_values[j], p_indices[j]);
+
+            // Next stage
+            continue;
+        }
+
+        // Slide the elements the filter keeps to the front
+        for (size_t j = 0; j < count; j++)
+        {
+
+            // Initialized data
+            void   *p_value = p_values[j];
+            size_t  index   = p_indices[j];
+
+            // Store unconditionally; only a kept element advances the cursor
+            p_values[kept]  = p_value;
+            p_indices[kept] = index;
+            kept += (size_t) pfn_predicate(p_value, index);
+        }
+
+        // Fewer elements for the next stage
+        count = kept;
+    }
+
+    // Done
+    return count;
+}
+
+int tuple_pipeline_map ( tuple_pipeline *const p_pipeline, void *(*const pfn_map)(void *const value, size_t index) )
+{
+
+    // Argument check
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( pfn_map    == (void *) 0 ) goto no_function;
+
+    // Record the stage
+    if ( tuple_pipeline_append(p_pipeline, pfn_map, (void *) 0) == 0 ) goto no_mem;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                TUPLE_ERROR(TUPLE_STATUS_NO_PIPELINE, "[tuple] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_function:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_map\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_pipeline_filter ( tuple_pipeline *const p_pipeline, bool (*const pfn_predicate)(void *const value, size_t index) )
+{
+
+    // Argument check
+    if ( p_pipeline    == (void *) 0 ) goto no_pipeline;
+    if ( pfn_predicate == (void *) 0 ) goto no_function;
+
+    // Record the stage
+    if ( tuple_pipeline_append(p_pipeline, (void *) 0, pfn_predicate) == 0 ) goto no_mem;
+
+    // The pipeline may now drop elements
+    p_pipeline->filters++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                TUPLE_ERROR(TUPLE_STATUS_NO_PIPELINE, "[tuple] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_function:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_predicate\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_pipeline_collect ( const tuple_pipeline *const p_pipeline, tuple **const pp_result )
+{
+
+    // Argument check
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( pp_result  == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    void *const *p_elements = tuple_elements(p_pipeline->p_source);
+    size_t       size       = p_pipeline->p_source->element_count,
+                 kept       = 0;
+    tuple       *p_result   = (void *) 0;
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // Without filters, the size is known, so the result comes from the usual allocators
+    if ( p_pipeline->filters == 0 ) p_result = tuple_allocate(size);
+
+    // With filters, the result is sized for every element, on the heap, and shrunk afterwards
+    else if ( size <= ( ( (size_t) -1 - sizeof(tuple) ) / sizeof(void *) ) && ( p_result = TUPLE_REALLOC(0, sizeof(tuple) + size * sizeof(void *)) ) )
+    {
+        p_result->_flags = 0;
+        atomic_init(&p_result->_references, 1);
+    }
+
+    // Error check
+    if ( p_result == (void *) 0 ) goto no_mem;
+
+    // One pass, a block at a time. Each block is copied to the result right after the last
+    // element kept so far, and goes through every stage there
+    for (size_t i = 0; i < size; i += TUPLE_PIPELINE_BLOCK)
+    {
+
+        // Initialized data
+        size_t _indices[TUPLE_PIPELINE_BLOCK];
+        size_t count = ( size - i < TUPLE_PIPELINE_BLOCK ) ? size - i : TUPLE_PIPELINE_BLOCK;
+
+        // Load the block
+        memcpy(&p_result->_elements[kept], &p_elements[i], count * sizeof(void *));
+        for (size_t j = 0; j < count; j++) _indices[j] = i + j;
+
+        // Run the stages, and keep what every filter keeps
+        kept += tuple_pipeline_run(p_pipeline, &p_result->_elements[kept], _indices, count);
+    }
+
+    // Store the quantity of elements
+    p_result->element_count = kept;
+
+    // Give back the room for dropped elements. Shrinking does not move the elements, and if
+    // it fails, the tuple keeps the larger block
+    if ( kept < size )
+    {
+
+        // Initialized data
+        tuple *p_shrunk = TUPLE_REALLOC(p_result, sizeof(tuple) + kept * sizeof(void *));
+
+        // Keep the smaller block
+        if ( p_shrunk ) p_result = p_shrunk;
+    }
+
+    // Return the tuple
+    *pp_result = p_result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                TUPLE_ERROR(TUPLE_STATUS_NO_PIPELINE, "[tuple] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_result:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_pipeline_reduce ( const tuple_pipeline *const p_pipeline, void *(*const pfn_reduce)(void *const left, void *const right), void *const p_identity, void **const pp_result )
+{
+
+    // Argument check
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+    if ( pfn_reduce == (void *) 0 ) goto no_function;
+    if ( pp_result  == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    void *const *p_elements  = tuple_elements(p_pipeline->p_source);
+    size_t       size        = p_pipeline->p_source->element_count;
+    void        *accumulator = p_identity;
+
+    // Error check
+    if ( p_elements == (void *) 0 ) goto no_mem;
+
+    // One pass, a block at a time
+    for (size_t i = 0; i < size; i += TUPLE_PIPELINE_BLOCK)
+    {
+
+        // Initialized data
+        void   *_p_values[TUPLE_PIPELINE_BLOCK];
+        size_t  _indices[TUPLE_PIPELINE_BLOCK];
+        size_t  count = ( size - i < TUPLE_PIPELINE_BLOCK ) ? size - i : TUPLE_PIPELINE_BLOCK;
+
+        // Load the block
+        memcpy(_p_values, &p_elements[i], count * sizeof(void *));
+        for (size_t j = 0; j < count; j++) _indices[j] = i + j;
+
+        // Run the stages
+        count = tuple_pipeline_run(p_pipeline, _p_values, _indices, count);
+
+        // Fold what every filter kept, in order
+        for (size_t j = 0; j < count; j++) accumulator = pfn_reduce(accumulator, _p_values[j]);
+    }
+
+    // Return the result
+    *pp_result = accumulator;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pipeline:
+                TUPLE_ERROR(TUPLE_STATUS_NO_PIPELINE, "[tuple] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_function:
+                TUPLE_ERROR(TUPLE_STATUS_NO_FUNCTION, "[tuple] Null pointer provided for parameter \"pfn_reduce\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Get an element slot of a tuple as an atomic object
+ * 
+ * @param p_tuple the tuple, which has flat elements
+ * @param offset  the slot's offset, in bounds
+ * 
+ * @return the slot
+ */
+static _Atomic(void *) *tuple_slot ( const tuple *p_tuple, size_t offset )
+{
+
+    // Pointers and atomic pointers share a size and representation on every supported platform
+    return (_Atomic(void *) *) &TUPLE_ARRAY(p_tuple)[offset];
+}
+
+int tuple_set ( tuple *const p_tuple, signed long long index, void *const value, memory_order order )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( order != memory_order_relaxed && order != memory_order_release && order != memory_order_seq_cst ) goto bad_order;
+    if ( p_tuple->_flags & ( TUPLE_FLAG_TREE | TUPLE_FLAG_BORROWED ) ) goto read_only;
+
+    // Initialized data
+    size_t         offset   = 0;
+    atomic_ullong *p_cached = tuple_hash_slot(p_tuple);
+
+    // Bounds check
+    if ( tuple_offset(index, p_tuple->element_count, &offset) == 0 ) goto bounds_error;
+
+    // Stop caching the identity hash before the element changes. A hash of the old elements
+    // can no longer be published, and a reader ordered after the update sees TUPLE_HASH_UPDATED
+    if ( p_cached ) atomic_store_explicit(p_cached, TUPLE_HASH_UPDATED, memory_order_relaxed);
+
+    // Store the element
+    atomic_store_explicit(tuple_slot(p_tuple, offset), value, order);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bad_order:
+                TUPLE_ERROR(TUPLE_STATUS_BAD_ORDER, "[tuple] Parameter \"order\" must be relaxed, release, or seq_cst in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            read_only:
+                TUPLE_ERROR(TUPLE_STATUS_READ_ONLY, "[tuple] Persistent and borrowed tuples can not be updated in place in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_exchange ( tuple *const p_tuple, signed long long index, void *const value, void **const pp_old, memory_order order )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( p_tuple->_flags & ( TUPLE_FLAG_TREE | TUPLE_FLAG_BORROWED ) ) goto read_only;
+
+    // Initialized data
+    size_t         offset   = 0;
+    void          *p_old    = (void *) 0;
+    atomic_ullong *p_cached = tuple_hash_slot(p_tuple);
+
+    // Bounds check
+    if ( tuple_offset(index, p_tuple->element_count, &offset) == 0 ) goto bounds_error;
+
+    // Stop caching the identity hash before the element changes. A hash of the old elements
+    // can no longer be published, and a reader ordered after the update sees TUPLE_HASH_UPDATED
+    if ( p_cached ) atomic_store_explicit(p_cached, TUPLE_HASH_UPDATED, memory_order_relaxed);
+
+    // Swap the element
+    p_old = atomic_exchange_explicit(tuple_slot(p_tuple, offset), value, order);
+
+    // Return the old element
+    if ( pp_old ) *pp_old = p_old;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            read_only:
+                TUPLE_ERROR(TUPLE_STATUS_READ_ONLY, "[tuple] Persistent and borrowed tuples can not be updated in place in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool tuple_compare_exchange ( tuple *const p_tuple, signed long long index, void **const pp_expected, void *const desired, memory_order success, memory_order failure )
+{
+
+    // Argument check
+    if ( p_tuple     == (void *) 0 ) goto no_tuple;
+    if ( pp_expected == (void *) 0 ) goto no_value;
+    if ( failure == memory_order_release || failure == memory_order_acq_rel ) goto bad_order;
+    if ( p_tuple->_flags & ( TUPLE_FLAG_TREE | TUPLE_FLAG_BORROWED ) ) goto read_only;
+
+    // Initialized data
+    size_t         offset   = 0;
+    atomic_ullong *p_cached = tuple_hash_slot(p_tuple);
+
+    // Bounds check
+    if ( tuple_offset(index, p_tuple->element_count, &offset) == 0 ) goto bounds_error;
+
+    // Stop caching the identity hash before the element may change. A hash of the old elements
+    // can no longer be published, and a reader ordered after the update sees TUPLE_HASH_UPDATED
+    if ( p_cached ) atomic_store_explicit(p_cached, TUPLE_HASH_UPDATED, memory_order_relaxed);
+
+    // Lost the race. The caller gets the element that won
+    if ( atomic_compare_exchange_strong_explicit(tuple_slot(p_tuple, offset), pp_expected, desired, success, failure) == false ) return false;
+
+    // Success
+    return true;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_expected\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            bad_order:
+                TUPLE_ERROR(TUPLE_STATUS_BAD_ORDER, "[tuple] Parameter \"failure\" can not be release or acq_rel in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            read_only:
+                TUPLE_ERROR(TUPLE_STATUS_READ_ONLY, "[tuple] Persistent and borrowed tuples can not be updated in place in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return false;
+        }
+    }
+}
+
+int tuple_index_acquire ( const tuple *const p_tuple, signed long long index, void **const pp_value )
+{
+
+    // Argument check
+    if ( p_tuple  == (void *) 0 ) goto no_tuple;
+    if ( pp_value == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    size_t offset = 0;
+
+    // Bounds check
+    if ( tuple_offset(index, p_tuple->element_count, &offset) == 0 ) goto bounds_error;
+
+    // Load the element. Persistent tuples are never written, so they need no ordering
+    *pp_value = ( ( p_tuple->_flags & TUPLE_FLAG_TREE ) == 0 ) ? atomic_load_explicit(tuple_slot(p_tuple, offset), memory_order_acquire) : tuple_element(p_tuple, offset);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+
+            bounds_error:
+                TUPLE_ERROR(TUPLE_STATUS_BOUNDS_ERROR, "[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_retain ( tuple *const p_tuple )
+{
+
+    // Argument check
+    if ( p_tuple == (void *) 0 ) goto no_tuple;
+
+    // Add a reference. The caller already holds one, so no ordering is needed
+    atomic_fetch_add_explicit(&p_tuple->_references, 1, memory_order_relaxed);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Get the calling thread's epoch record, registering the thread on first use
+ * 
+ * @param void
+ * 
+ * @return pointer to the record on success, null pointer on error
+ */
+static struct tuple_epoch_record_s *tuple_epoch_register ( void )
+{
+
+    // Initialized data
+    struct tuple_epoch_record_s *p_record = p_tuple_epoch_record;
+
+    // Fast exit
+    if ( TUPLE_LIKELY(p_record != (void *) 0) ) return p_record;
+
+    // Lock
+    mutex_lock(&tuple_epoch_lock);
+
+    // Reuse a record left behind by a thread that exited ...
+    for ( p_record = atomic_load_explicit(&p_tuple_epoch_records, memory_order_acquire); p_record; p_record = p_record->p_next )
+        if ( atomic_load_explicit(&p_record->in_use, memory_order_relaxed) == false ) break;
+
+    // ... or make a new one
+    if ( p_record == (void *) 0 )
+    {
+
+        // Allocate a record
+        p_record = TUPLE_REALLOC(0, sizeof(struct tuple_epoch_record_s));
+
+        // Error check
+        if ( p_record == (void *) 0 ) goto no_mem;
+
+        // Zero set
+        memset(p_record, 0, sizeof(struct tuple_epoch_record_s));
+
+        // Publish it. Readers of the registry never see a record half built
+        p_record->p_next = atomic_load_explicit(&p_tuple_epoch_records, memory_order_relaxed);
+        atomic_store_explicit(&p_tuple_epoch_records, p_record, memory_order_release);
+    }
+
+    // Claim the record
+    atomic_store_explicit(&p_record->in_use, true, memory_order_relaxed);
+
+    // Unlock
+    mutex_unlock(&tuple_epoch_lock);
+
+    // Give the record back when the thread exits
+    #ifndef _WIN64
+        pthread_setspecific(tuple_epoch_key, p_record);
+    #endif
+
+    // Remember it
+    p_tuple_epoch_record = p_record;
+
+    // Success
+    return p_record;
+
+    // Error handling
+    no_mem:
+
+        // Unlock
+        mutex_unlock(&tuple_epoch_lock);
+
+        // Error
+        return (void *) 0;
+}
+
+/** !
+ * Advance the global epoch if every thread that is reading has seen the current one
+ * 
+ * @param void
+ * 
+ * @return the global epoch after the attempt
+ */
+static size_t tuple_epoch_advance ( void )
+{
+
+    // Initialized data
+    size_t epoch = atomic_load_explicit(&tuple_epoch, memory_order_seq_cst);
+
+    // Check every reader
+    for ( struct tuple_epoch_record_s *p_record = atomic_load_explicit(&p_tuple_epoch_records, memory_order_acquire); p_record; p_record = p_record->p_next )
+    {
+
+        // Initialized data
+        size_t state = atomic_load_explicit(&p_record->state, memory_order_seq_cst);
+
+        // A reader is still in an older epoch
+        if ( ( state & 1 ) && ( state >> 1 ) != epoch ) return epoch;
+    }
+
+    // Move on. Losing the race means another thread advanced it
+    if ( atomic_compare_exchange_strong(&tuple_epoch, &epoch, epoch + 1) ) epoch++;
+
+    // Done
+    return epoch;
+}
+
+/** !
+ * Release the tuples in a bag
+ * 
+ * @param p_bag the bag
+ * 
+ * @return void
+ */
+static void tuple_epoch_bag_free ( struct tuple_epoch_bag_s *p_bag )
+{
+
+    // Release each tuple
+    for (size_t i = 0; i < p_bag->count; i++) tuple_unreference(p_bag->_p_tuples[i]);
+
+    // Empty
+    p_bag->count = 0;
+
+    // Done
+    return;
+}
+
+/** !
+ * Release every bag of a record that no reader can still see. Tuples retired in epoch e are
+ * safe once the global epoch reaches e + 2
+ * 
+ * @param p_record the record
+ * @param epoch    the global epoch
+ * 
+ * @return void
+ */
+static void tuple_epoch_collect ( struct tuple_epoch_record_s *p_record, size_t epoch )
+{
+
+    // Check each bag
+    for (size_t i = 0; i < TUPLE_EPOCH_BAGS; i++)
+        if ( p_record->_bags[i].count && p_record->_bags[i].epoch + 2 <= epoch )
+            tuple_epoch_bag_free(&p_record->_bags[i]);
+
+    // Done
+    return;
+}
+
+/** !
+ * Release every bag that no reader can still see from the records of threads that exited
+ * 
+ * @param epoch the global epoch
+ * 
+ * @return void
+ */
+static void tuple_epoch_collect_orphans ( size_t epoch )
+{
+
+    // Initialized data
+    size_t orphans = 0;
+
+    // Fast exit
+    if ( atomic_load_explicit(&tuple_epoch_orphans, memory_order_relaxed) == 0 ) return;
+
+    // Lock, so no thread claims a record while its bags are released
+    mutex_lock(&tuple_epoch_lock);
+
+    // Each record without an owner
+    for ( struct tuple_epoch_record_s *p_record = atomic_load_explicit(&p_tuple_epoch_records, memory_order_acquire); p_record; p_record = p_record->p_next )
+    {
+
+        // Skip records owned by a live thread
+        if ( atomic_load_explicit(&p_record->in_use, memory_order_relaxed) ) continue;
+
+        // Release what is safe
+        tuple_epoch_collect(p_record, epoch);
+
+        // Count records still holding tuples
+        for (size_t i = 0; i < TUPLE_EPOCH_BAGS; i++)
+            if ( p_record->_bags[i].count ) { orphans++; break; }
+    }
+
+    // Store the records left for the next call
+    atomic_store_explicit(&tuple_epoch_orphans, orphans, memory_order_relaxed);
+
+    // Unlock
+    mutex_unlock(&tuple_epoch_lock);
+
+    // Done
+    return;
+}
+
+int tuple_read_enter ( void )
+{
+
+    // Initialized data
+    struct tuple_epoch_record_s *p_record = tuple_epoch_register();
+
+    // Error check
+    if ( p_record == (void *) 0 ) goto no_mem;
+
+    // Nested sections share the outermost one's epoch
+    if ( p_record->nesting++ ) return 1;
+
+    // Announce the epoch this thread is reading in
+    atomic_store_explicit(&p_record->state, ( atomic_load_explicit(&tuple_epoch, memory_order_relaxed) << 1 ) | 1, memory_order_seq_cst);
+
+    // Make the announcement visible before any tuple is read
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_read_exit ( void )
+{
+
+    // Initialized data
+    struct tuple_epoch_record_s *p_record = p_tuple_epoch_record;
+
+    // State check
+    if ( p_record == (void *) 0 || p_record->nesting == 0 ) goto not_reading;
+
+    // Leave the outermost section
+    if ( --p_record->nesting == 0 )
+        atomic_store_explicit(&p_record->state, 0, memory_order_release);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            not_reading:
+                TUPLE_ERROR(TUPLE_STATUS_NOT_READING, "[tuple] Call to \"tuple_read_exit\" without a matching \"tuple_read_enter\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_destroy_deferred ( tuple **const pp_tuple )
+{
+
+    // Argument check
+    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+
+    // Initialized data
+    tuple                       *p_tuple  = *pp_tuple;
+    struct tuple_epoch_record_s *p_record = (void *) 0;
+    struct tuple_epoch_bag_s    *p_bag    = (void *) 0;
+    size_t                       epoch    = 0;
+
+    // Nothing to free
+    if ( p_tuple == (void *) 0 ) return 1;
+
+    // Get the calling thread's record
+    p_record = tuple_epoch_register();
+
+    // Error check
+    if ( p_record == (void *) 0 ) goto no_mem;
+
+    // Label the tuple with the current epoch
+    epoch = atomic_load_explicit(&tuple_epoch, memory_order_seq_cst);
+    p_bag = &p_record->_bags[epoch % TUPLE_EPOCH_BAGS];
+
+    // A bag from three or more epochs ago is safe to empty before reuse
+    if ( p_bag->epoch != epoch )
+    {
+        tuple_epoch_bag_free(p_bag);
+        p_bag->epoch = epoch;
+    }
+
+    // Grow the bag
+    if ( p_bag->count == p_bag->max )
+    {
+
+        // Initialized data
+        size_t   max        = ( p_bag->max ) ? p_bag->max * 2 : TUPLE_EPOCH_BATCH;
+        tuple  **p_tuples   = TUPLE_REALLOC(p_bag->_p_tuples, max * sizeof(tuple *));
+
+        // Error check
+        if ( p_tuples == (void *) 0 ) goto no_mem;
+
+        // Update the bag
+        p_bag->_p_tuples = p_tuples;
+        p_bag->max       = max;
+    }
+
+    // Retire the tuple
+    p_bag->_p_tuples[p_bag->count++] = p_tuple;
+
+    // No more pointer for caller
+    *pp_tuple = (void *) 0;
+
+    // Reclaim in batches
+    if ( p_bag->count % TUPLE_EPOCH_BATCH == 0 ) tuple_epoch_collect(p_record, tuple_epoch_advance());
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_tuple:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int tuple_reclaim ( void )
+{
+
+    // Initialized data
+    struct tuple_epoch_record_s *p_record = p_tuple_epoch_record;
+    size_t                       epoch    = tuple_epoch_advance();
+
+    // Release what is safe from threads that exited
+    tuple_epoch_collect_orphans(epoch);
+
+    // Nothing deferred on this thread
+    if ( p_record == (void *) 0 ) return 1;
+
+    // Release what is safe
+    tuple_epoch_collect(p_record, epoch);
+
+    // Success
+    return 1;
+}
+
+int tuple_release ( tuple **const pp_tuple )
 {
 
     // Argument check
     if ( pp_tuple == (void *) 0 ) goto no_tuple;
 
-    // Allocate memory for a tuple
-    tuple *p_tuple = TUPLE_REALLOC(0, sizeof(tuple));
+    // Initialized data
+    tuple *p_tuple = *pp_tuple;
 
-    // Error checking
-    if ( p_tuple == (void *) 0 ) goto no_mem;
+    // No more pointer for caller
+    *pp_tuple = (void *) 0;
 
-    // Zero set
-    memset(p_tuple, 0, sizeof(tuple));
+    // Nothing to release
+    if ( p_tuple == (void *) 0 ) return 1;
 
-    // Return the allocated memory
-    *pp_tuple = p_tuple;
+    // Give up the caller's reference
+    tuple_unreference(p_tuple);
 
     // Success
     return 1;
@@ -63,51 +8221,32 @@ int tuple_create ( tuple **const pp_tuple )
         // Argument errors
         {
             no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-        }
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
 
-        // Standard library errors
-        {
-            no_mem:
-                #ifndef NDEBUG
-                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-                
                 // Error
                 return 0;
         }
     }
 }
 
-int tuple_construct ( tuple **const pp_tuple, size_t size )
+int tuple_destroy ( tuple **const pp_tuple )
 {
 
     // Argument check
     if ( pp_tuple == (void *) 0 ) goto no_tuple;
 
     // Initialized data
-    tuple *p_tuple = 0;
-
-    // Allocate a tuple
-    if ( tuple_create(&p_tuple) == 0 ) goto failed_to_create_tuple;
-
-    // Set the count and iterator max
-    p_tuple->element_count = size;
-
-    // Grow the allocation
-    p_tuple = TUPLE_REALLOC(p_tuple, sizeof(tuple) + ( size * sizeof(void *) ) );
+    tuple *p_tuple = *pp_tuple;
 
-    // Error checking
-    if ( p_tuple == (void *) 0 ) goto no_mem;
+    // No more pointer for caller
+    *pp_tuple = (void *) 0;
 
-    // Return a pointer to the caller
-    *pp_tuple = p_tuple;
+    // Nothing to free
+    if ( p_tuple == (void *) 0 ) return 1;
 
+    // Give up the caller's reference, and free the tuple if it was the last
+    tuple_unreference(p_tuple);
+    
     // Success
     return 1;
 
@@ -117,62 +8256,75 @@ int tuple_construct ( tuple **const pp_tuple, size_t size )
         // Argument errors
         {
             no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;                
-        }
-
-        // Tuple errors
-        {
-            failed_to_create_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Failed to create tuple in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-        }
-
-        // Standard library errors
-        {
-            no_mem:
-                #ifndef NDEBUG
-                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
 
-                // Error 
+                // Error
                 return 0;
         }
     }
 }
 
-int tuple_from_elements ( tuple **const pp_tuple, void *const *const elements, size_t size )
+int tuple_detach ( tuple **const pp_tuple, void ***const ppp_elements, size_t *const p_size )
 {
 
     // Argument check
-    if ( pp_tuple == (void *) 0 ) goto no_tuple;
-    if ( elements == (void *) 0 ) goto no_elements;
+    if ( pp_tuple     == (void *) 0 ) goto no_tuple;
+    if ( *pp_tuple    == (void *) 0 ) goto no_tuple;
+    if ( ppp_elements == (void *) 0 ) goto no_value;
 
     // Initialized data
-    tuple *p_tuple = 0;
+    tuple   *p_tuple    = *pp_tuple;
+    size_t   size       = p_tuple->element_count;
+    void   **p_elements = (void *) 0;
 
-    // Allocate a tuple
-    if ( tuple_construct(&p_tuple, size) == 0 ) goto failed_to_allocate_tuple;        
+    // A sole owner of an adopted array hands the array itself over ...
+    if ( ( p_tuple->_flags & TUPLE_FLAG_OWNER ) && atomic_load_explicit(&p_tuple->_references, memory_order_acquire) == 1 )
+    {
 
-    // Iterate over each key
-    for (size_t i = 0; elements[i]; i++)
+        // Take the array
+        p_elements = p_tuple->_elements[0];
 
-        // Add the key to the tuple
-        p_tuple->_p_elements[i] = elements[i];
+        // The header no longer owns it
+        p_tuple->_flags &= ~(unsigned int) TUPLE_FLAG_OWNER;
 
-    // Set the quantity of elements
-    p_tuple->element_count = size;
+        // Free the header
+        tuple_deallocate(p_tuple);
+    }
 
-    // Return
-    *pp_tuple = p_tuple;
+    // ... and everyone else gets a copy
+    else
+    {
+
+        // Copy the elements
+        if ( size )
+        {
+
+            // Initialized data
+            void *const *p_source = tuple_elements(p_tuple);
+
+            // Error check
+            if ( p_source == (void *) 0 ) goto no_mem;
+
+            // Allocate an array
+            p_elements = TUPLE_REALLOC(0, size * sizeof(void *));
+
+            // Error check
+            if ( p_elements == (void *) 0 ) goto no_mem;
+
+            // Copy
+            memcpy(p_elements, p_source, size * sizeof(void *));
+        }
+
+        // Give up the caller's reference
+        tuple_unreference(p_tuple);
+    }
+
+    // No more pointer for caller
+    *pp_tuple = (void *) 0;
+
+    // Return the elements
+    *ppp_elements = p_elements;
+    if ( p_size ) *p_size = size;
 
     // Success
     return 1;
@@ -183,28 +8335,22 @@ int tuple_from_elements ( tuple **const pp_tuple, void *const *const elements, s
         // Argument errors
         {
             no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
 
-                // Error 
+                // Error
                 return 0;
 
-            no_elements:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"keys\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_value:
+                TUPLE_ERROR(TUPLE_STATUS_NO_VALUE, "[tuple] Null pointer provided for parameter \"ppp_elements\" in call to function \"%s\"\n", __FUNCTION__);
 
-                // Error 
+                // Error
                 return 0;
         }
 
-        // Tuple errors
+        // Standard library errors
         {
-            failed_to_allocate_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Call to \"tuple_construct\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_mem:
+                TUPLE_ERROR(TUPLE_STATUS_NO_MEM, "[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
 
                 // Error
                 return 0;
@@ -212,36 +8358,21 @@ int tuple_from_elements ( tuple **const pp_tuple, void *const *const elements, s
     }
 }
 
-int tuple_from_arguments ( tuple **const pp_tuple, size_t element_count, ... )
+int tuple_destroy_batch ( tuple ***const ppp_tuples )
 {
 
     // Argument check
-    if ( pp_tuple      == (void *) 0 ) goto no_tuple;
-    if ( element_count ==          0 ) goto no_elements;
-
-    // Uninitialized data
-    va_list list;
+    if ( ppp_tuples  == (void *) 0 ) goto no_tuple;
+    if ( *ppp_tuples == (void *) 0 ) goto no_tuple;
 
     // Initialized data
-    tuple *p_tuple = 0;
-
-    // Initialize the variadic list
-    va_start(list, element_count);
-
-    // Allocate a tuple
-    if ( tuple_construct(&p_tuple, element_count) == 0 ) goto failed_to_allocate_tuple;        
-
-    // Iterate over each key
-    for (size_t i = 0; i < element_count; i++)
+    struct tuple_batch_s *p_batch = (struct tuple_batch_s *) ( (unsigned char *) *ppp_tuples - offsetof(struct tuple_batch_s, _p_tuples) );
 
-        // Add the key to the tuple
-        p_tuple->_p_elements[i] = va_arg(list, void *);
-    
-    // End the variadic list
-    va_end(list);
+    // No more pointer for caller
+    *ppp_tuples = (void *) 0;
 
-    // Return
-    *pp_tuple = p_tuple;
+    // Free the block
+    p_batch = TUPLE_REALLOC(p_batch, 0);
 
     // Success
     return 1;
@@ -252,28 +8383,7 @@ int tuple_from_arguments ( tuple **const pp_tuple, size_t element_count, ... )
         // Argument errors
         {
             no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-
-            no_elements:
-                #ifndef NDEBUG
-                    log_error("[tuple] Parameter \"element_count\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-        }
-
-        // Tuple errors
-        {
-            failed_to_allocate_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Call to \"tuple_construct\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+                TUPLE_ERROR(TUPLE_STATUS_NO_TUPLE, "[tuple] Null pointer provided for parameter \"ppp_tuples\" in call to function \"%s\"\n", __FUNCTION__);
 
                 // Error
                 return 0;
@@ -281,75 +8391,63 @@ int tuple_from_arguments ( tuple **const pp_tuple, size_t element_count, ... )
     }
 }
 
-int tuple_index ( const tuple *const p_tuple, signed long long index, void **const pp_value )
+int tuple_builder_destroy ( tuple_builder **const pp_builder )
 {
 
     // Argument check
-    if ( p_tuple                == (void *) 0 ) goto no_tuple;
-    if ( p_tuple->element_count ==          0 ) goto no_elements;
-    if ( pp_value               == (void *) 0 ) goto no_value;
+    if ( pp_builder  == (void *) 0 ) goto no_builder;
+    if ( *pp_builder == (void *) 0 ) goto no_builder;
 
-    // Error check
-    if ( p_tuple->element_count == (size_t) llabs(index) ) goto bounds_error;
+    // Initialized data
+    tuple_builder *p_builder = *pp_builder;
 
-    // Positive index
-    if ( index >= 0 )
-        *pp_value = p_tuple->_p_elements[index];
+    // No more pointer for caller
+    *pp_builder = (void *) 0;
 
-    // Negative numbers
-    else 
-        *pp_value = p_tuple->_p_elements[p_tuple->element_count - (size_t) ( index * -1 )];
+    // Free the buffer
+    if ( p_builder->p_tuple ) p_builder->p_tuple = TUPLE_REALLOC(p_builder->p_tuple, 0);
+
+    // Free the builder
+    p_builder = TUPLE_REALLOC(p_builder, 0);
 
     // Success
     return 1;
 
     // Error handling
     {
-        no_tuple:
-            #ifndef NDEBUG
-                log_error("[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-            #endif
-
-            // Error
-            return 0;
-
-        no_value:
-            #ifndef NDEBUG
-                log_error("[tuple] Null pointer provided for parameter \"pp_vale\" in call to function \"%s\"\n", __FUNCTION__);
-            #endif
-
-            // Error
-            return 0;
 
-        no_elements:
-            #ifndef NDEBUG
-                log_error("[tuple] Can not index an empty tuple in call to function \"%s\"\n", __FUNCTION__);
-            #endif
-
-            // Error 
-            return 0;
-        
-        bounds_error:
-            #ifndef NDEBUG
-                log_error("[tuple] Index out of bounds in call to function \"%s\"\n", __FUNCTION__);
-            #endif
+        // Argument errors
+        {
+            no_builder:
+                TUPLE_ERROR(TUPLE_STATUS_NO_BUILDER, "[tuple] Null pointer provided for parameter \"pp_builder\" in call to function \"%s\"\n", __FUNCTION__);
 
-            // Error
-            return 0;
+                // Error
+                return 0;
+        }
     }
 }
 
-int tuple_slice ( const tuple *const p_tuple, const void **const pp_elements, signed long long lower_bound, signed long long  upper_bound )
+int tuple_pipeline_destroy ( tuple_pipeline **const pp_pipeline )
 {
 
     // Argument check
-    if ( p_tuple == (void *) 0 ) goto no_tuple;
-    if ( pp_elements == 0 ) goto no_elemenets;
-    if ( lower_bound < 0 ) goto erroneous_lower_bound;
-    if ( p_tuple->element_count < (size_t) upper_bound ) goto erroneous_upper_bound;
+    if ( pp_pipeline  == (void *) 0 ) goto no_pipeline;
+    if ( *pp_pipeline == (void *) 0 ) goto no_pipeline;
 
-    // Return the elements
-    memcpy(pp_elements, &p_tuple->_p_elements[lower_bound], sizeof(void *) * (size_t) ( upper_bound - lower_bound + 1 ) );
+    // Initialized data
+    tuple_pipeline *p_pipeline = *pp_pipeline;
+
+    // No more pointer for caller
+    *pp_pipeline = (void *) 0;
+
+    // Let go of the source
+    tuple_release(&p_pipeline->p_source);
+
+    // Free the stages
+    p_pipeline->_p_stages = TUPLE_REALLOC(p_pipeline->_p_stages, 0);
+
+    // Free the pipeline
+    p_pipeline = TUPLE_REALLOC(p_pipeline, 0);
 
     // Success
     return 1;
@@ -359,59 +8457,50 @@ int tuple_slice ( const tuple *const p_tuple, const void **const pp_elements, si
 
         // Argument errors
         {
-            no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-
-            erroneous_lower_bound:
-                #ifndef NDEBUG
-                    log_error("[tuple] Parameter \"lower_bound\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-                
-            erroneous_upper_bound:
-                #ifndef NDEBUG
-                    log_error("[tuple] Parameter \"upper_bound\" must be less than or equal to tuple size in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error 
-                return 0;
-
-            no_elemenets:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_pipeline:
+                TUPLE_ERROR(TUPLE_STATUS_NO_PIPELINE, "[tuple] Null pointer provided for parameter \"pp_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
 
-                // Error 
+                // Error
                 return 0;
         }
     }
 }
 
-bool tuple_is_empty ( const tuple *const p_tuple )
+int tuple_pool_destroy ( tuple_pool **const pp_pool )
 {
 
     // Argument check
-    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( pp_pool  == (void *) 0 ) goto no_pool;
+    if ( *pp_pool == (void *) 0 ) goto no_pool;
+
+    // Initialized data
+    tuple_pool *p_pool = *pp_pool;
+
+    // No more pointer for caller
+    *pp_pool = (void *) 0;
+
+    // Detach the calling thread
+    if ( tuple_pool_cache.p_pool == p_pool ) tuple_pool_cache = (struct tuple_pool_cache_s) { 0 };
+
+    // Release every slab
+    tuple_pool_reset(p_pool);
+
+    // Destroy the lock
+    mutex_destroy(&p_pool->_lock);
+
+    // Free the pool
+    p_pool = TUPLE_REALLOC(p_pool, 0);
 
     // Success
-    return ( p_tuple->element_count == 0 );
+    return 1;
 
     // Error handling
     {
 
         // Argument errors
         {
-            no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_pool:
+                TUPLE_ERROR(TUPLE_STATUS_NO_POOL, "[tuple] Null pointer provided for parameter \"pp_pool\" in call to function \"%s\"\n", __FUNCTION__);
 
                 // Error
                 return 0;
@@ -419,24 +8508,49 @@ bool tuple_is_empty ( const tuple *const p_tuple )
     }
 }
 
-size_t tuple_size ( const tuple *const p_tuple )
+int tuple_arena_destroy ( tuple_arena **const pp_arena )
 {
 
     // Argument check
-    if ( p_tuple == (void *) 0 ) goto no_tuple;
+    if ( pp_arena  == (void *) 0 ) goto no_arena;
+    if ( *pp_arena == (void *) 0 ) goto no_arena;
+
+    // Initialized data
+    tuple_arena *p_arena = *pp_arena;
+
+    // No more pointer for caller
+    *pp_arena = (void *) 0;
+
+    // Detach the calling thread
+    if ( p_tuple_arena == p_arena ) p_tuple_arena = (void *) 0;
+
+    // Free every chunk
+    while ( p_arena->p_head )
+    {
+
+        // Initialized data
+        struct tuple_arena_chunk_s *p_chunk = p_arena->p_head;
+
+        // Advance
+        p_arena->p_head = p_chunk->p_next;
+
+        // Free the chunk
+        p_chunk = TUPLE_REALLOC(p_chunk, 0);
+    }
+
+    // Free the arena
+    p_arena = TUPLE_REALLOC(p_arena, 0);
 
     // Success
-    return p_tuple->element_count;
+    return 1;
 
     // Error handling
     {
 
         // Argument errors
         {
-            no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_arena:
+                TUPLE_ERROR(TUPLE_STATUS_NO_ARENA, "[tuple] Null pointer provided for parameter \"pp_arena\" in call to function \"%s\"\n", __FUNCTION__);
 
                 // Error
                 return 0;
@@ -444,39 +8558,51 @@ size_t tuple_size ( const tuple *const p_tuple )
     }
 }
 
-int tuple_foreach ( const tuple *const p_tuple, void (*const pfn_function)(void *const value, size_t index) )
+int tuple_intern_table_destroy ( tuple_intern_table **const pp_table )
 {
 
     // Argument check
-    if ( p_tuple      == (void *) 0 ) goto no_tuple;
-    if ( pfn_function == (void *) 0 ) goto no_func;
+    if ( pp_table  == (void *) 0 ) goto no_table;
+    if ( *pp_table == (void *) 0 ) goto no_table;
 
-    // Iterate over each element in the tuple
-    for (size_t i = 0; i < p_tuple->element_count; i++)
-        
-        // Call the function
-        pfn_function(p_tuple->_p_elements[i], i);
+    // Initialized data
+    tuple_intern_table *p_table = *pp_table;
+
+    // No more pointer for caller
+    *pp_table = (void *) 0;
+
+    // Release each stripe
+    for (size_t i = 0; i < TUPLE_INTERN_STRIPES; i++)
+    {
+
+        // Initialized data
+        struct tuple_intern_stripe_s *p_stripe = &p_table->_stripes[i];
+
+        // Release the table's reference to each tuple
+        for (size_t j = 0; j < p_stripe->capacity; j++)
+            if ( p_stripe->_p_slots[j].p_tuple && p_stripe->_p_slots[j].p_tuple != (tuple *) p_stripe )
+                tuple_unreference(p_stripe->_p_slots[j].p_tuple);
+
+        // Free the slots
+        if ( p_stripe->_p_slots ) p_stripe->_p_slots = TUPLE_REALLOC(p_stripe->_p_slots, 0);
+
+        // Destroy the lock
+        mutex_destroy(&p_stripe->_lock);
+    }
+
+    // Free the table
+    p_table = TUPLE_REALLOC(p_table, 0);
 
     // Success
     return 1;
 
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"p_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-
-                // Error
-                return 0;
-            
-            no_func:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"pfn_function\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"pp_table\" in call to function \"%s\"\n", __FUNCTION__);
 
                 // Error
                 return 0;
@@ -484,21 +8610,25 @@ int tuple_foreach ( const tuple *const p_tuple, void (*const pfn_function)(void
     }
 }
 
-int tuple_destroy ( tuple **const pp_tuple )
+int tuple_table_destroy ( tuple_table **const pp_table )
 {
 
     // Argument check
-    if ( pp_tuple == (void *) 0 ) goto no_tuple;
+    if ( pp_table  == (void *) 0 ) goto no_table;
+    if ( *pp_table == (void *) 0 ) goto no_table;
 
     // Initialized data
-    tuple *p_tuple = *pp_tuple;
+    tuple_table *p_table = *pp_table;
 
     // No more pointer for caller
-    *pp_tuple = (void *) 0;
+    *pp_table = (void *) 0;
+
+    // Free the columns
+    if ( p_table->_p_data ) p_table->_p_data = TUPLE_REALLOC(p_table->_p_data, 0);
+
+    // Free the table
+    p_table = TUPLE_REALLOC(p_table, 0);
 
-    // Free the tuple
-    p_tuple = TUPLE_REALLOC(p_tuple, 0);
-    
     // Success
     return 1;
 
@@ -507,10 +8637,8 @@ int tuple_destroy ( tuple **const pp_tuple )
 
         // Argument errors
         {
-            no_tuple:
-                #ifndef NDEBUG
-                    log_error("[tuple] Null pointer provided for parameter \"pp_tuple\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
+            no_table:
+                TUPLE_ERROR(TUPLE_STATUS_NO_TABLE, "[tuple] Null pointer provided for parameter \"pp_table\" in call to function \"%s\"\n", __FUNCTION__);
 
                 // Error
                 return 0;
@@ -524,12 +8652,47 @@ void tuple_exit ( void )
     // State check
     if ( initialized == false ) return;
 
+    // Stop the worker pool
+    #ifndef _WIN64
+        pthread_mutex_lock(&tuple_workers._job_lock);
+        tuple_parallel_stop();
+        pthread_mutex_unlock(&tuple_workers._job_lock);
+    #endif
+
+    // Release every deferred tuple, and every epoch record
+    while ( atomic_load(&p_tuple_epoch_records) )
+    {
+
+        // Initialized data
+        struct tuple_epoch_record_s *p_record = atomic_load(&p_tuple_epoch_records);
+
+        // Advance
+        atomic_store(&p_tuple_epoch_records, p_record->p_next);
+
+        // Release each bag
+        for (size_t i = 0; i < TUPLE_EPOCH_BAGS; i++)
+        {
+            tuple_epoch_bag_free(&p_record->_bags[i]);
+            if ( p_record->_bags[i]._p_tuples ) p_record->_bags[i]._p_tuples = TUPLE_REALLOC(p_record->_bags[i]._p_tuples, 0);
+        }
+
+        // Free the record
+        p_record = TUPLE_REALLOC(p_record, 0);
+    }
+
+    // Forget the calling thread's record
+    p_tuple_epoch_record = (void *) 0;
+    atomic_store(&tuple_epoch_orphans, 0);
+
+    // Threads that exit from here on have no record or cache to hand back
+    #ifndef _WIN64
+        pthread_key_delete(tuple_epoch_key);
+        pthread_key_delete(tuple_pool_key);
+    #endif
+
     // Clean up log
     log_exit();
 
-    // TODO: Anything else?
-    // 
-
     // Clear the initialized flag
     initialized = false;
 
@@ -0,0 +1,2153 @@
+/** !
+ * Tuple benchmark
+ *
+ * @file tuple_bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+// log module
+#include <log/log.h>
+
+// sync module
+#include <sync/sync.h>
+
+// Forward declarations
+void *tuple_bench_realloc ( void *p, size_t size );
+
+// Route every allocation made by the tuple library through the counter
+#define TUPLE_REALLOC(p, sz) tuple_bench_realloc(p, sz)
+
+// tuple (compiled in, so the allocator hook applies to the library code)
+#include "tuple.c"
+#include <tuple/tuple_fast.h>
+
+// Preprocessor definitions
+#define BENCH_ITERATIONS 1000000
+#define BENCH_MAX_THREADS 8
+#define BENCH_REQUEST_SIZE 256
+#define BENCH_WIDE_SIZE    4096
+#define BENCH_PARALLEL_SIZE 65536
+#define BENCH_PARALLEL_WORK 256
+#define BENCH_SLOTS         64
+#define BENCH_SORT_SIZE     ( 1 << 20 )
+#define BENCH_JOIN_LEFT     10000000
+#define BENCH_JOIN_RIGHT    1000000
+#define BENCH_JOIN_NESTED   64
+
+// Structure definitions
+struct bench_thread_s
+{
+    pthread_t           thread;     // The thread
+    tuple_pool         *p_pool;     // Pool to attach, or null for the heap
+    tuple_intern_table *p_table;    // Intern table, or null to construct every tuple
+    size_t              iterations; // Tuples to build
+    size_t              calls;      // Allocator calls made by the thread
+};
+
+struct bench_shared_s
+{
+    _Alignas(64) tuple *_Atomic p_tuple;   // The tuple readers see
+    _Alignas(64) mutex          _lock;     // Guards p_tuple in the locked variant
+    _Alignas(64) atomic_size_t  running;   // Readers still reading
+    bool                        use_epoch; // Read sections, or the lock
+};
+
+struct bench_slots_s
+{
+    _Alignas(64) tuple *p_tuple; // The tuple every writer updates
+    _Alignas(64) mutex  _lock;   // Guards the elements in the locked variant
+    int                 mode;    // 0 = lock, 1 = tuple_set, 2 = tuple_compare_exchange
+};
+
+// Data
+_Thread_local size_t allocator_calls = 0;
+size_t bench_results[BENCH_PARALLEL_SIZE] = { 0 };
+void  *bench_elements[] = { "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M", "N", "O", "P" };
+char   bench_find_missing[] = "Q";
+void  *bench_stage_buffer[BENCH_WIDE_SIZE] = { 0 };
+size_t bench_stage_kept = 0;
+
+// Forward declarations
+int run_benchmarks      ( void );
+int print_bench         ( const char *name, size_t arity, size_t iterations, size_t calls, timestamp elapsed );
+
+int bench_construct     ( const char *name, size_t arity, int (*pfn_constructor)(tuple **pp_tuple, size_t size) );
+int construct_legacy    ( tuple **pp_tuple, size_t size );
+int construct_new       ( tuple **pp_tuple, size_t size );
+int construct_elements  ( tuple **pp_tuple, size_t size );
+int construct_arguments ( tuple **pp_tuple, size_t size );
+
+int   bench_pool        ( const char *name, size_t arity, bool use_pool );
+int   bench_threads     ( const char *name, size_t threads, bool use_pool );
+void *bench_churn       ( void *p_parameter );
+int   bench_requests    ( const char *name, bool use_arena );
+int   bench_accessors   ( void );
+int   bench_errors      ( const char *name, size_t log_limit );
+int   bench_epoch       ( const char *name, size_t threads, bool use_epoch );
+void *bench_epoch_read  ( void *p_parameter );
+int   bench_parallel    ( const char *name, size_t threads, size_t grain );
+void  bench_heavy       ( void *const value, size_t index );
+int   bench_hash        ( const char *name, size_t arity, int mode );
+unsigned long long bench_hash_string ( const void *const value );
+int   bench_compare     ( const char *name, size_t arity, int mode );
+int   bench_strcmp      ( const void *const a, const void *const b );
+int   bench_intern      ( const char *name, size_t threads, bool use_intern );
+void *bench_keys        ( void *p_parameter );
+int   bench_table       ( void );
+int   bench_batch       ( const char *name, bool use_batch );
+int   bench_builder     ( const char *name, size_t arity, bool use_builder );
+int   bench_adopt       ( const char *name, size_t arity, bool use_adopt );
+int   bench_with        ( const char *name, size_t arity, bool use_with );
+int   bench_slots       ( const char *name, size_t threads, int mode );
+void *bench_slot_writer ( void *p_parameter );
+int   bench_find        ( const char *name, size_t arity, int mode );
+bool  bench_is_missing  ( void *const value, size_t index );
+int   bench_gather      ( const char *name, size_t fields, bool use_many );
+int   bench_concat      ( const char *name, size_t arity, bool use_concat );
+int   bench_project     ( const char *name, size_t rows, int mode );
+int   bench_pipeline    ( const char *name, size_t arity, bool use_pipeline );
+void *bench_stage_scale ( void *const value, size_t index );
+bool  bench_stage_keep  ( void *const value, size_t index );
+void  bench_stage_map   ( void *const value, size_t index );
+void  bench_stage_filter ( void *const value, size_t index );
+int   bench_sort        ( const char *name, size_t threads, int mode );
+int   bench_qsort_compare ( const void *a, const void *b );
+int   bench_sort_compare  ( const void *const a, const void *const b );
+int   bench_join        ( const char *name, size_t threads, int mode );
+
+// Entry point
+int main ( int argc, const char* argv[] )
+{
+
+    // Suppress warnings
+    (void) argc;
+    (void) argv;
+
+    // Formatting
+    printf(
+        "╭─────────────────╮\n"\
+        "│ tuple benchmark │\n"\
+        "╰─────────────────╯\n\n"
+    );
+
+    // Run benchmarks
+    run_benchmarks();
+
+    // Success
+    return EXIT_SUCCESS;
+}
+
+void *tuple_bench_realloc ( void *p, size_t size )
+{
+
+    // Count allocations, not frees
+    if ( size ) allocator_calls++;
+
+    // Done
+    return realloc(p, size);
+}
+
+int run_benchmarks ( void )
+{
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "constructor", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Allocator calls per tuple, before and after
+    for (size_t arity = 1; arity <= 8; arity *= 2)
+    {
+        bench_construct("create + grow (legacy)", arity, construct_legacy);
+        bench_construct("tuple_construct"       , arity, construct_new);
+        bench_construct("tuple_from_elements"   , arity, construct_elements);
+        bench_construct("tuple_from_arguments"  , arity, construct_arguments);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "pool", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Churn with and without a pool
+    for (size_t arity = 1; arity <= 16; arity *= 2)
+    {
+        bench_pool("heap", arity, false);
+        bench_pool("tuple_pool", arity, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "pool (threads)", "thrds", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Scaling across threads
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        bench_threads("heap", threads, false);
+        bench_threads("tuple_pool", threads, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "arena", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Many tuples that die together
+    bench_requests("heap", false);
+    bench_requests("tuple_arena", true);
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "accessor", "width", "reads", "allocs/read", "ns/read");
+
+    // Out of line, inline, and unchecked reads
+    bench_accessors();
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "failure path", "limit", "calls", "allocs/call", "ns/call");
+
+    // Out of bounds reads with logging off, and rate limited to one message a second
+    bench_errors("logging off", 0);
+    bench_errors("logging rate limited", 1);
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "shared reads", "thrds", "reads", "allocs/read", "ns/read");
+
+    // Readers racing a writer that keeps replacing the tuple
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        bench_epoch("mutex", threads, false);
+        bench_epoch("tuple_read_enter", threads, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "foreach", "thrds", "elements", "allocs/elem", "ns/elem");
+
+    // CPU heavy callbacks over a wide tuple, serially then across the worker pool
+    bench_parallel("tuple_foreach", 0, 0);
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+        bench_parallel("tuple_foreach_parallel", threads, 0);
+    bench_parallel("grain 1", BENCH_MAX_THREADS, 1);
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "hash", "arity", "hashes", "allocs/hash", "ns/hash");
+
+    // Rehashing every lookup, the cached identity hash, and content hashing
+    for (size_t arity = 4; arity <= BENCH_WIDE_SIZE; arity *= 32)
+    {
+        bench_hash("rehash every call", arity, 0);
+        bench_hash("tuple_hash", arity, 1);
+        bench_hash("tuple_hash (content)", arity, 2);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "compare", "arity", "compares", "allocs/cmp", "ns/cmp");
+
+    // Hand written loops over tuple_index, against tuple_equals and tuple_compare
+    for (size_t arity = 4; arity <= BENCH_WIDE_SIZE; arity *= 32)
+    {
+        bench_compare("tuple_index loop", arity, 0);
+        bench_compare("tuple_equals", arity, 1);
+        bench_compare("tuple_compare", arity, 2);
+        bench_compare("tuple_compare (strcmp)", arity, 3);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "intern", "thrds", "tuples", "allocs/tuple", "ns/tuple");
+
+    // ( tenant, region, metric ) keys, 1000 distinct, built over and over
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        bench_intern("tuple_from_elements", threads, false);
+        bench_intern("tuple_intern", threads, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "rows", "arity", "rows", "allocs/row", "ns/row");
+
+    // A million rows as separate tuples, and as one columnar table
+    bench_table();
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "batch", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Batches of mixed arity tuples, one by one and in one block
+    bench_batch("one block per tuple", false);
+    bench_batch("one block per batch", true);
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "unknown arity", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Tuples whose size isn't known until the last element, buffered twice, and built in place
+    for (size_t arity = 4; arity <= 64; arity *= 4)
+    {
+        bench_builder("buffer + from_elements", arity, false);
+        bench_builder("tuple_builder", arity, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "array to tuple and back", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Move an array into a tuple and back out, by copying, and by handing it over
+    for (size_t arity = 16; arity <= BENCH_WIDE_SIZE; arity *= 16)
+    {
+        bench_adopt("from_elements + copy", arity, false);
+        bench_adopt("adopt + detach", arity, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "single element update", "arity", "updates", "allocs/update", "ns/update");
+
+    // Change one element at a time, by copying, and with structural sharing
+    for (size_t arity = 1024; arity <= BENCH_WIDE_SIZE * 4; arity *= 4)
+    {
+        bench_with("copy + from_elements", arity, false);
+        bench_with("tuple_with", arity, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "shared slots", "thrds", "updates", "allocs/update", "ns/update");
+
+    // Writers updating the slots of one shared tuple, under a lock, and with atomics
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        bench_slots("mutex + write", threads, 0);
+        bench_slots("tuple_set", threads, 1);
+        bench_slots("tuple_compare_exchange", threads, 2);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "search", "arity", "searches", "allocs/search", "ns/search");
+
+    // Look for an element that isn't there, through tuple_index, and with the search functions
+    for (size_t arity = 16; arity <= BENCH_WIDE_SIZE; arity *= 16)
+    {
+        bench_find("tuple_index loop", arity, 0);
+        bench_find("tuple_find", arity, 1);
+        bench_find("tuple_count", arity, 2);
+        bench_find("tuple_find_if", arity, 3);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "gather", "fields", "projections", "allocs/proj", "ns/proj");
+
+    // Project scattered fields out of a wide record, one call per field, and in one batch
+    for (size_t fields = 4; fields <= 256; fields *= 4)
+    {
+        bench_gather("tuple_index loop", fields, false);
+        bench_gather("tuple_index_many", fields, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "concat", "arity", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Join four tuples, through a sliced buffer, and directly
+    for (size_t arity = 4; arity <= 256; arity *= 8)
+    {
+        bench_concat("slice + from_elements", arity, false);
+        bench_concat("tuple_concat", arity, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "project", "fields", "rows", "allocs/row", "ns/row");
+
+    // Pick 4 of 16 fields from 1000 rows, field by field, row by row, and in one batch
+    bench_project("index + from_elements", 1000, 0);
+    bench_project("tuple_project", 1000, 1);
+    bench_project("tuple_project_batch", 1000, 2);
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "map filter map", "arity", "runs", "allocs/run", "ns/run");
+
+    // Three stages, with a tuple after each, and fused into one pass
+    for (size_t arity = 16; arity <= BENCH_WIDE_SIZE; arity *= 16)
+    {
+        bench_pipeline("foreach + from_elements", arity, false);
+        bench_pipeline("tuple_pipeline_collect", arity, true);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "sort by key", "thrds", "tuples", "allocs/tuple", "ns/tuple");
+
+    // A million rows by a random key, with qsort over tuple_index, then by address and by comparator on more threads
+    bench_sort("qsort + tuple_index", 1, 0);
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        bench_sort("tuple_array_sort", threads, 1);
+        bench_sort("tuple_array_sort (cmp)", threads, 2);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Output
+    log_info("%-24s %6s %12s %14s %10s\n", "hash join", "thrds", "tuples", "allocs/tuple", "ns/tuple");
+
+    // Ten million rows against a million, half of them matching. Nested loops over tuple_index only run a few rows,
+    // then both sides are sort merged with a tuple_concat per match, then hash joined on more threads
+    bench_join("nested loops + concat", 1, 3);
+    bench_join("sort merge + concat", 1, 0);
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        bench_join("tuple_join (inner)", threads, 1);
+        bench_join("tuple_join (left)", threads, 2);
+    }
+
+    // Formatting
+    putchar('\n');
+
+    // Success
+    return 1;
+}
+
+int print_bench ( const char *name, size_t arity, size_t iterations, size_t calls, timestamp elapsed )
+{
+
+    // Output
+    log_info("%-24s %6zu %12zu %14.2f %10.2f\n",
+        name,
+        arity,
+        iterations,
+        (double) calls / (double) iterations,
+        (double) elapsed / (double) timer_seconds_divisor() * 1000000000.0 / (double) iterations
+    );
+
+    // Success
+    return 1;
+}
+
+int bench_construct ( const char *name, size_t arity, int (*pfn_constructor)(tuple **pp_tuple, size_t size) )
+{
+
+    // Initialized data
+    tuple     *p_tuple = 0;
+    timestamp  t0      = 0,
+               t1      = 0;
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Build and destroy tuples
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        pfn_constructor(&p_tuple, arity);
+        tuple_destroy(&p_tuple);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, BENCH_ITERATIONS, allocator_calls, t1 - t0);
+
+    // Success
+    return 1;
+}
+
+int construct_legacy ( tuple **pp_tuple, size_t size )
+{
+
+    // Allocate the header ...
+    tuple *p_tuple = TUPLE_REALLOC(0, sizeof(tuple));
+
+    // Error check
+    if ( p_tuple == (void *) 0 ) return 0;
+
+    // ... zero it ...
+    memset(p_tuple, 0, sizeof(tuple));
+
+    // ... then grow it to fit the elements
+    p_tuple = TUPLE_REALLOC(p_tuple, sizeof(tuple) + ( size * sizeof(void *) ) );
+
+    // Error check
+    if ( p_tuple == (void *) 0 ) return 0;
+
+    // Copy the elements one at a time
+    for (size_t i = 0; i < size; i++) p_tuple->_elements[i] = bench_elements[i];
+
+    // Set the quantity of elements, and the caller's reference
+    p_tuple->element_count = size;
+    atomic_init(&p_tuple->_references, 1);
+
+    // Return
+    *pp_tuple = p_tuple;
+
+    // Success
+    return 1;
+}
+
+int construct_new ( tuple **pp_tuple, size_t size )
+{
+
+    // Success
+    return tuple_construct(pp_tuple, size);
+}
+
+int construct_elements ( tuple **pp_tuple, size_t size )
+{
+
+    // Success
+    return tuple_from_elements(pp_tuple, bench_elements, size);
+}
+
+int construct_arguments ( tuple **pp_tuple, size_t size )
+{
+
+    // Pass as many arguments as the arity calls for
+    switch ( size )
+    {
+        case 1: return tuple_from_arguments(pp_tuple, 1, bench_elements[0]);
+        case 2: return tuple_from_arguments(pp_tuple, 2, bench_elements[0], bench_elements[1]);
+        case 4: return tuple_from_arguments(pp_tuple, 4, bench_elements[0], bench_elements[1], bench_elements[2], bench_elements[3]);
+        default:
+            return tuple_from_arguments(pp_tuple, 8,
+                bench_elements[0], bench_elements[1], bench_elements[2], bench_elements[3],
+                bench_elements[4], bench_elements[5], bench_elements[6], bench_elements[7]
+            );
+    }
+}
+
+int bench_pool ( const char *name, size_t arity, bool use_pool )
+{
+
+    // Initialized data
+    tuple_pool *p_pool  = 0;
+    tuple      *p_tuple = 0;
+    timestamp   t0      = 0,
+                t1      = 0;
+
+    // Attach a pool
+    if ( use_pool ) tuple_pool_create(&p_pool), tuple_pool_attach(p_pool);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Build and destroy tuples
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        tuple_from_elements(&p_tuple, bench_elements, arity);
+        tuple_destroy(&p_tuple);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, BENCH_ITERATIONS, allocator_calls, t1 - t0);
+
+    // Detach and destroy the pool
+    if ( use_pool ) tuple_pool_attach(0), tuple_pool_destroy(&p_pool);
+
+    // Success
+    return 1;
+}
+
+void *bench_churn ( void *p_parameter )
+{
+
+    // Initialized data
+    struct bench_thread_s *p_thread    = p_parameter;
+    tuple                 *p_tuples[8] = { 0 };
+
+    // Attach the shared pool
+    if ( p_thread->p_pool ) tuple_pool_attach(p_thread->p_pool);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Keep a few tuples of mixed arity alive at once
+    for (size_t i = 0; i < p_thread->iterations; i++)
+    {
+
+        // Initialized data
+        size_t slot = i & 7;
+
+        // Replace the tuple in the slot
+        tuple_destroy(&p_tuples[slot]);
+        tuple_from_elements(&p_tuples[slot], bench_elements, slot + 1);
+    }
+
+    // Clean up
+    for (size_t i = 0; i < 8; i++) tuple_destroy(&p_tuples[i]);
+
+    // Report the allocator calls
+    p_thread->calls = allocator_calls;
+
+    // Detach
+    tuple_pool_attach(0);
+
+    // Done
+    return (void *) 0;
+}
+
+int bench_threads ( const char *name, size_t threads, bool use_pool )
+{
+
+    // Initialized data
+    struct bench_thread_s _threads[BENCH_MAX_THREADS] = { 0 };
+    tuple_pool           *p_pool = 0;
+    size_t                calls  = 0;
+    timestamp             t0     = 0,
+                          t1     = 0;
+
+    // Construct a shared pool
+    if ( use_pool ) tuple_pool_create(&p_pool);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Start each thread
+    for (size_t i = 0; i < threads; i++)
+    {
+        _threads[i] = (struct bench_thread_s) { .p_pool = p_pool, .iterations = BENCH_ITERATIONS };
+        pthread_create(&_threads[i].thread, 0, bench_churn, &_threads[i]);
+    }
+
+    // Wait for each thread
+    for (size_t i = 0; i < threads; i++)
+    {
+        pthread_join(_threads[i].thread, 0);
+        calls += _threads[i].calls;
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report wall time per tuple across every thread
+    print_bench(name, threads, threads * BENCH_ITERATIONS, calls, t1 - t0);
+
+    // Destroy the pool
+    if ( use_pool ) tuple_pool_destroy(&p_pool);
+
+    // Success
+    return 1;
+}
+
+int bench_requests ( const char *name, bool use_arena )
+{
+
+    // Initialized data
+    tuple_arena *p_arena                       = 0;
+    tuple       *p_tuples[BENCH_REQUEST_SIZE] = { 0 };
+    timestamp    t0                            = 0,
+                 t1                            = 0;
+
+    // Attach an arena
+    if ( use_arena ) tuple_arena_create(&p_arena), tuple_arena_attach(p_arena);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Each request builds a batch of tuples, then releases all of them
+    for (size_t i = 0; i < BENCH_ITERATIONS / BENCH_REQUEST_SIZE; i++)
+    {
+
+        // Build
+        for (size_t j = 0; j < BENCH_REQUEST_SIZE; j++)
+            tuple_from_elements(&p_tuples[j], bench_elements, ( j & 7 ) + 1);
+
+        // Release
+        if   ( use_arena ) tuple_arena_reset(p_arena);
+        else for (size_t j = 0; j < BENCH_REQUEST_SIZE; j++) tuple_destroy(&p_tuples[j]);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report. Arity is mixed, up to 8
+    print_bench(name, 8, ( BENCH_ITERATIONS / BENCH_REQUEST_SIZE ) * BENCH_REQUEST_SIZE, allocator_calls, t1 - t0);
+
+    // Detach and destroy the arena
+    if ( use_arena ) tuple_arena_attach(0), tuple_arena_destroy(&p_arena);
+
+    // Success
+    return 1;
+}
+
+int bench_accessors ( void )
+{
+
+    // Initialized data
+    int          (*volatile pfn_index)(const tuple *const, signed long long, void **const) = tuple_index;
+    tuple         *p_tuple = 0;
+    void          *value   = 0;
+    size_t         sum     = 0,
+                   reads   = ( BENCH_ITERATIONS / BENCH_WIDE_SIZE ) * BENCH_WIDE_SIZE * 16;
+    timestamp      t0      = 0,
+                   t1      = 0;
+
+    // Build a wide tuple
+    tuple_construct(&p_tuple, BENCH_WIDE_SIZE);
+
+    // Out of line, through a pointer as through the shared library's PLT
+    t0 = timer_high_precision();
+    for (size_t r = 0; r < reads / BENCH_WIDE_SIZE; r++)
+        for (size_t i = 0; i < tuple_size(p_tuple); i++)
+            pfn_index(p_tuple, (signed long long) i, &value), sum += (size_t) value;
+    t1 = timer_high_precision();
+    print_bench("tuple_index", BENCH_WIDE_SIZE, reads, 0, t1 - t0);
+
+    // Inline, checked
+    t0 = timer_high_precision();
+    for (size_t r = 0; r < reads / BENCH_WIDE_SIZE; r++)
+        for (size_t i = 0; i < tuple_size_fast(p_tuple); i++)
+            tuple_index_fast(p_tuple, (signed long long) i, &value), sum += (size_t) value;
+    t1 = timer_high_precision();
+    print_bench("tuple_index_fast", BENCH_WIDE_SIZE, reads, 0, t1 - t0);
+
+    // Inline, unchecked
+    t0 = timer_high_precision();
+    for (size_t r = 0; r < reads / BENCH_WIDE_SIZE; r++)
+        for (size_t i = 0; i < tuple_size_unchecked(p_tuple); i++)
+            sum += (size_t) tuple_index_unchecked(p_tuple, (signed long long) i);
+    t1 = timer_high_precision();
+    print_bench("tuple_index_unchecked", BENCH_WIDE_SIZE, reads, 0, t1 - t0);
+
+    // Keep the sum alive
+    if ( sum ) log_info("%zu\n", sum);
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Success
+    return 1;
+}
+
+int bench_errors ( const char *name, size_t log_limit )
+{
+
+    // Initialized data
+    tuple     *p_tuple = 0;
+    void      *value   = 0;
+    timestamp  t0      = 0,
+               t1      = 0;
+
+    // Build [ A, B ]
+    tuple_from_elements(&p_tuple, bench_elements, 2);
+
+    // Set the log limit
+    tuple_log_limit(log_limit);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Every read is out of bounds
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++)
+        tuple_index(p_tuple, 2, &value);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, log_limit, BENCH_ITERATIONS, 0, t1 - t0);
+
+    // Logging back off
+    tuple_log_limit(0);
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Success
+    return 1;
+}
+
+void *bench_epoch_read ( void *p_parameter )
+{
+
+    // Initialized data
+    struct bench_shared_s *p_shared = p_parameter;
+    void                  *value    = 0;
+    size_t                 sum      = 0;
+
+    // Read the current tuple over and over
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+
+        // Enter
+        if   ( p_shared->use_epoch ) tuple_read_enter();
+        else                         mutex_lock(&p_shared->_lock);
+
+        // Read every element
+        for (size_t j = 0; j < 8; j++)
+            tuple_index(atomic_load_explicit(&p_shared->p_tuple, memory_order_acquire), (signed long long) j, &value), sum += (size_t) value;
+
+        // Exit
+        if   ( p_shared->use_epoch ) tuple_read_exit();
+        else                         mutex_unlock(&p_shared->_lock);
+    }
+
+    // Let the writer stop
+    atomic_fetch_sub(&p_shared->running, 1);
+
+    // Done
+    return (void *) sum;
+}
+
+int bench_epoch ( const char *name, size_t threads, bool use_epoch )
+{
+
+    // Initialized data
+    struct bench_shared_s  shared                      = { .use_epoch = use_epoch, .running = threads };
+    pthread_t              _threads[BENCH_MAX_THREADS] = { 0 };
+    tuple                 *p_tuple                     = 0;
+    size_t                 swaps                       = 0;
+    timestamp              t0                          = 0,
+                           t1                          = 0;
+
+    // Publish the first tuple
+    mutex_create(&shared._lock);
+    tuple_from_elements(&p_tuple, bench_elements, 8);
+    atomic_init(&shared.p_tuple, p_tuple);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Start each reader
+    for (size_t i = 0; i < threads; i++) pthread_create(&_threads[i], 0, bench_epoch_read, &shared);
+
+    // Replace the tuple until the readers are done
+    while ( atomic_load(&shared.running) )
+    {
+
+        // Build the replacement
+        tuple_from_elements(&p_tuple, bench_elements, 8);
+
+        // Swap it in
+        if   ( use_epoch ) p_tuple = atomic_exchange(&shared.p_tuple, p_tuple);
+        else mutex_lock(&shared._lock), p_tuple = atomic_exchange(&shared.p_tuple, p_tuple), mutex_unlock(&shared._lock);
+
+        // Retire the old one
+        if   ( use_epoch ) tuple_destroy_deferred(&p_tuple);
+        else               tuple_destroy(&p_tuple);
+
+        // Count
+        swaps++;
+    }
+
+    // Wait for each reader
+    for (size_t i = 0; i < threads; i++) pthread_join(_threads[i], 0);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report wall time per read section across every reader
+    print_bench(name, threads, threads * BENCH_ITERATIONS, 0, t1 - t0);
+
+    // Clean up
+    p_tuple = atomic_exchange(&shared.p_tuple, (tuple *) 0);
+    tuple_destroy(&p_tuple);
+    tuple_reclaim();
+    mutex_destroy(&shared._lock);
+
+    // Keep the writer honest
+    if ( swaps == 0 ) log_warning("No swaps\n");
+
+    // Success
+    return 1;
+}
+
+void bench_heavy ( void *const value, size_t index )
+{
+
+    // Initialized data
+    size_t x = (size_t) value + index;
+
+    // Burn some cycles
+    for (size_t i = 0; i < BENCH_PARALLEL_WORK; i++) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+
+    // Each index has its own slot, so no two threads write the same one
+    bench_results[index] = x;
+}
+
+int bench_parallel ( const char *name, size_t threads, size_t grain )
+{
+
+    // Initialized data
+    tuple     *p_tuple = 0;
+    timestamp  t0      = 0,
+               t1      = 0;
+
+    // Build a wide tuple, and size the pool. The caller is one of the threads
+    tuple_construct(&p_tuple, BENCH_PARALLEL_SIZE);
+    if ( threads ) tuple_parallel_threads(threads);
+
+    // Start the pool outside the timed region
+    if ( threads ) tuple_foreach_parallel(p_tuple, bench_heavy, grain);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Visit every element
+    if   ( threads ) tuple_foreach_parallel(p_tuple, bench_heavy, grain);
+    else             tuple_foreach(p_tuple, bench_heavy);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, ( threads ) ? threads : 1, BENCH_PARALLEL_SIZE, 0, t1 - t0);
+
+    // Back to the default pool size
+    tuple_parallel_threads(0);
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Success
+    return 1;
+}
+
+unsigned long long bench_hash_string ( const void *const value )
+{
+
+    // Initialized data
+    unsigned long long hash = 14695981039346656037ULL;
+
+    // FNV-1a
+    for (const char *p = value; *p; p++) hash = ( hash ^ (unsigned char) *p ) * 1099511628211ULL;
+
+    // Done
+    return hash;
+}
+
+int bench_hash ( const char *name, size_t arity, int mode )
+{
+
+    // Initialized data
+    tuple              *p_tuple    = 0;
+    void              **p_elements = 0;
+    unsigned long long  hash       = 0,
+                        sum        = 0;
+    size_t              hashes     = (size_t) BENCH_ITERATIONS / ( ( arity > 64 ) ? 64 : 1 );
+    timestamp           t0         = 0,
+                        t1         = 0;
+
+    // Build a tuple of strings
+    tuple_construct(&p_tuple, arity);
+    p_elements = (void **) tuple_data(p_tuple);
+    for (size_t i = 0; i < arity; i++) p_elements[i] = bench_elements[i & 15];
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Hash the same tuple over and over, as a hash table lookup would
+    for (size_t i = 0; i < hashes; i++)
+    {
+        if      ( mode == 0 ) hash = tuple_hash_elements(p_tuple->_elements, p_tuple->element_count, (void *) 0);
+        else if ( mode == 1 ) tuple_hash(p_tuple, (void *) 0, &hash);
+        else                  tuple_hash(p_tuple, bench_hash_string, &hash);
+        sum += hash;
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, hashes, 0, t1 - t0);
+
+    // Keep the sum alive
+    if ( sum == 0 ) log_info("%llu\n", sum);
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Success
+    return 1;
+}
+
+int bench_strcmp ( const void *const a, const void *const b )
+{
+
+    // Order by content
+    return strcmp(a, b);
+}
+
+int bench_compare ( const char *name, size_t arity, int mode )
+{
+
+    // Initialized data
+    tuple      *p_a       = 0,
+               *p_b       = 0;
+    size_t      compares  = (size_t) BENCH_ITERATIONS / ( ( arity > 64 ) ? 64 : 1 ),
+                equal     = 0;
+    timestamp   t0        = 0,
+                t1        = 0;
+
+    // Build two equal tuples of strings, the worst case for a comparison
+    tuple_construct(&p_a, arity);
+    tuple_construct(&p_b, arity);
+    for (size_t i = 0; i < arity; i++)
+        ((void **) tuple_data(p_a))[i] = ((void **) tuple_data(p_b))[i] = bench_elements[i & 15];
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Compare
+    for (size_t i = 0; i < compares; i++)
+    {
+
+        // Element by element, with every call checking its arguments
+        if ( mode == 0 )
+        {
+
+            // Initialized data
+            bool same = tuple_size(p_a) == tuple_size(p_b);
+
+            // Compare each element
+            for (size_t j = 0; same && j < tuple_size(p_a); j++)
+            {
+
+                // Initialized data
+                void *a = 0,
+                     *b = 0;
+
+                // Compare
+                tuple_index(p_a, (signed long long) j, &a);
+                tuple_index(p_b, (signed long long) j, &b);
+                same = ( a == b );
+            }
+
+            // Count
+            equal += same;
+        }
+        else if ( mode == 1 ) equal += tuple_equals(p_a, p_b, (void *) 0);
+        else if ( mode == 2 ) equal += ( tuple_compare(p_a, p_b, (void *) 0) == 0 );
+        else                  equal += ( tuple_compare(p_a, p_b, bench_strcmp) == 0 );
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, compares, 0, t1 - t0);
+
+    // Keep the count alive
+    if ( equal != compares ) log_warning("Mismatch\n");
+
+    // Clean up
+    tuple_destroy(&p_a);
+    tuple_destroy(&p_b);
+
+    // Success
+    return 1;
+}
+
+void *bench_keys ( void *p_parameter )
+{
+
+    // Initialized data
+    struct bench_thread_s *p_thread = p_parameter;
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Build each key
+    for (size_t i = 0; i < p_thread->iterations; i++)
+    {
+
+        // Initialized data
+        void  *_p_key[3] = { bench_elements[i % 10], bench_elements[( i / 10 ) % 10], bench_elements[( i / 100 ) % 10] };
+        tuple *p_tuple   = 0;
+
+        // Construct, or find the canonical tuple
+        if   ( p_thread->p_table ) tuple_intern(p_thread->p_table, _p_key, 3, &p_tuple);
+        else                       tuple_from_elements(&p_tuple, _p_key, 3);
+
+        // Done with it
+        tuple_release(&p_tuple);
+    }
+
+    // Report the allocator calls
+    p_thread->calls = allocator_calls;
+
+    // Done
+    return (void *) 0;
+}
+
+int bench_intern ( const char *name, size_t threads, bool use_intern )
+{
+
+    // Initialized data
+    struct bench_thread_s  _threads[BENCH_MAX_THREADS] = { 0 };
+    tuple_intern_table    *p_table = 0;
+    size_t                 calls   = 0;
+    timestamp              t0      = 0,
+                           t1      = 0;
+
+    // Construct a table
+    if ( use_intern ) tuple_intern_table_create(&p_table, (void *) 0, (void *) 0);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Start each thread
+    for (size_t i = 0; i < threads; i++)
+    {
+        _threads[i] = (struct bench_thread_s) { .p_table = p_table, .iterations = BENCH_ITERATIONS };
+        pthread_create(&_threads[i].thread, 0, bench_keys, &_threads[i]);
+    }
+
+    // Wait for each thread
+    for (size_t i = 0; i < threads; i++)
+    {
+        pthread_join(_threads[i].thread, 0);
+        calls += _threads[i].calls;
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report wall time per tuple across every thread
+    print_bench(name, threads, threads * BENCH_ITERATIONS, calls, t1 - t0);
+
+    // Destroy the table
+    if ( use_intern ) tuple_intern_table_destroy(&p_table);
+
+    // Success
+    return 1;
+}
+
+int bench_table ( void )
+{
+
+    // Initialized data
+    tuple       **p_tuples = TUPLE_REALLOC(0, BENCH_ITERATIONS * sizeof(tuple *));
+    tuple_table  *p_table  = 0;
+    void *const  *p_column = 0;
+    size_t        sum      = 0;
+    timestamp     t0       = 0,
+                  t1       = 0;
+
+    // Error check
+    if ( p_tuples == (void *) 0 ) return 0;
+
+    // Build a tuple per row
+    allocator_calls = 0;
+    t0 = timer_high_precision();
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) tuple_from_elements(&p_tuples[i], &bench_elements[i & 7], 4);
+    t1 = timer_high_precision();
+    print_bench("build tuples", 4, BENCH_ITERATIONS, allocator_calls, t1 - t0);
+
+    // Build a table
+    allocator_calls = 0;
+    t0 = timer_high_precision();
+    tuple_table_create(&p_table, 4);
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) tuple_table_append(p_table, &bench_elements[i & 7], (void *) 0);
+    t1 = timer_high_precision();
+    print_bench("build tuple_table", 4, BENCH_ITERATIONS, allocator_calls, t1 - t0);
+
+    // Scan the third element of every tuple
+    t0 = timer_high_precision();
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) sum += (size_t) tuple_index_unchecked(p_tuples[i], 2);
+    t1 = timer_high_precision();
+    print_bench("scan tuples", 4, BENCH_ITERATIONS, 0, t1 - t0);
+
+    // Scan the third column
+    t0 = timer_high_precision();
+    p_column = tuple_table_column(p_table, 2);
+    for (size_t i = 0; i < tuple_table_size(p_table); i++) sum += (size_t) p_column[i];
+    t1 = timer_high_precision();
+    print_bench("scan tuple_table", 4, BENCH_ITERATIONS, 0, t1 - t0);
+
+    // Keep the sum alive
+    if ( sum == 0 ) log_info("%zu\n", sum);
+
+    // Clean up
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) tuple_destroy(&p_tuples[i]);
+    p_tuples = TUPLE_REALLOC(p_tuples, 0);
+    tuple_table_destroy(&p_table);
+
+    // Success
+    return 1;
+}
+
+int bench_batch ( const char *name, bool use_batch )
+{
+
+    // Initialized data
+    tuple     *_p_tuples[BENCH_REQUEST_SIZE] = { 0 };
+    tuple    **p_tuples                      = _p_tuples;
+    void      *elements[BENCH_REQUEST_SIZE * 8] = { 0 };
+    size_t     sizes[BENCH_REQUEST_SIZE]     = { 0 };
+    size_t     batches                       = BENCH_ITERATIONS / BENCH_REQUEST_SIZE,
+               total                         = 0;
+    timestamp  t0                            = 0,
+               t1                            = 0;
+
+    // Arities 1 through 8, elements cycling through the sample strings
+    for (size_t i = 0; i < BENCH_REQUEST_SIZE; i++)
+    {
+        sizes[i]  = ( i & 7 ) + 1;
+        total    += sizes[i];
+    }
+    for (size_t i = 0; i < total; i++) elements[i] = bench_elements[i & 15];
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Build and free each batch
+    for (size_t b = 0; b < batches; b++)
+    {
+
+        // One block for every tuple
+        if ( use_batch )
+        {
+            tuple_from_elements_batch(&p_tuples, elements, sizes, BENCH_REQUEST_SIZE);
+            tuple_destroy_batch(&p_tuples);
+        }
+
+        // One allocation per tuple
+        else
+        {
+
+            // Initialized data
+            void *const *p_element = elements;
+
+            // Construct
+            for (size_t i = 0; i < BENCH_REQUEST_SIZE; i++)
+            {
+                tuple_from_elements(&p_tuples[i], p_element, sizes[i]);
+                p_element += sizes[i];
+            }
+
+            // Destroy
+            for (size_t i = 0; i < BENCH_REQUEST_SIZE; i++) tuple_destroy(&p_tuples[i]);
+        }
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report the mean arity
+    print_bench(name, total / BENCH_REQUEST_SIZE, batches * BENCH_REQUEST_SIZE, allocator_calls, t1 - t0);
+
+    // Success
+    return 1;
+}
+
+int bench_builder ( const char *name, size_t arity, bool use_builder )
+{
+
+    // Initialized data
+    tuple_builder  *p_builder  = 0;
+    tuple          *p_tuple    = 0;
+    void          **p_buffer   = 0;
+    size_t          capacity   = 0,
+                    iterations = BENCH_ITERATIONS / 8;
+    timestamp       t0         = 0,
+                    t1         = 0;
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Each builder is reused, as a parser would
+    if ( use_builder ) tuple_builder_create(&p_builder, 0);
+
+    // Build
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // Push each element, then freeze
+        if ( use_builder )
+        {
+            for (size_t j = 0; j < arity; j++) tuple_builder_push(p_builder, bench_elements[j & 15]);
+            tuple_builder_freeze(p_builder, &p_tuple);
+        }
+
+        // Grow a scratch buffer, then copy it into a tuple
+        else
+        {
+
+            // Initialized data
+            size_t size = 0;
+
+            // Buffer
+            for (size_t j = 0; j < arity; j++)
+            {
+
+                // Make room
+                if ( size == capacity )
+                {
+                    capacity = ( capacity ) ? capacity * 2 : 8;
+                    p_buffer = TUPLE_REALLOC(p_buffer, capacity * sizeof(void *));
+                }
+
+                // Store
+                p_buffer[size++] = bench_elements[j & 15];
+            }
+
+            // Copy
+            tuple_from_elements(&p_tuple, p_buffer, size);
+        }
+
+        // Free the tuple
+        tuple_destroy(&p_tuple);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, iterations, allocator_calls, t1 - t0);
+
+    // Clean up
+    if ( p_builder ) tuple_builder_destroy(&p_builder);
+    if ( p_buffer  ) p_buffer = TUPLE_REALLOC(p_buffer, 0);
+
+    // Success
+    return 1;
+}
+
+int bench_adopt ( const char *name, size_t arity, bool use_adopt )
+{
+
+    // Initialized data
+    tuple      *p_tuple    = 0;
+    void      **p_elements = TUPLE_REALLOC(0, arity * sizeof(void *));
+    size_t      iterations = BENCH_ITERATIONS / 8;
+    timestamp   t0         = 0,
+                t1         = 0;
+
+    // Error check
+    if ( p_elements == (void *) 0 ) return 0;
+
+    // Fill the array
+    for (size_t i = 0; i < arity; i++) p_elements[i] = bench_elements[i & 15];
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Round trip
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // Hand the array over, and take it back
+        if ( use_adopt )
+        {
+            tuple_adopt(&p_tuple, p_elements, arity);
+            tuple_detach(&p_tuple, &p_elements, (void *) 0);
+        }
+
+        // Copy the array in, and copy it back out
+        else
+        {
+            tuple_from_elements(&p_tuple, p_elements, arity);
+            memcpy(p_elements, tuple_data(p_tuple), arity * sizeof(void *));
+            tuple_destroy(&p_tuple);
+        }
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, iterations, allocator_calls, t1 - t0);
+
+    // Clean up
+    p_elements = TUPLE_REALLOC(p_elements, 0);
+
+    // Success
+    return 1;
+}
+
+int bench_with ( const char *name, size_t arity, bool use_with )
+{
+
+    // Initialized data
+    tuple      *p_tuple    = 0,
+               *p_next     = 0;
+    void      **p_scratch  = TUPLE_REALLOC(0, arity * sizeof(void *));
+    size_t      iterations = BENCH_ITERATIONS / 8;
+    timestamp   t0         = 0,
+                t1         = 0;
+
+    // Error check
+    if ( p_scratch == (void *) 0 ) return 0;
+
+    // Fill the first tuple
+    for (size_t i = 0; i < arity; i++) p_scratch[i] = bench_elements[i & 15];
+    tuple_from_elements(&p_tuple, p_scratch, arity);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Each update replaces the tuple, walking through every element
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // Copy one path, and share the rest
+        if ( use_with ) tuple_with(p_tuple, (signed long long) ( i % arity ), bench_elements[i & 15], &p_next);
+
+        // Copy everything
+        else
+        {
+            memcpy(p_scratch, tuple_data(p_tuple), arity * sizeof(void *));
+            p_scratch[i % arity] = bench_elements[i & 15];
+            tuple_from_elements(&p_next, p_scratch, arity);
+        }
+
+        // Replace the tuple
+        tuple_destroy(&p_tuple);
+        p_tuple = p_next;
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, iterations, allocator_calls, t1 - t0);
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    p_scratch = TUPLE_REALLOC(p_scratch, 0);
+
+    // Success
+    return 1;
+}
+
+void *bench_slot_writer ( void *p_parameter )
+{
+
+    // Initialized data
+    struct bench_slots_s *p_slots  = p_parameter;
+    void                 *expected = 0;
+
+    // Bump a slot of the shared tuple, over and over
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+
+        // Initialized data
+        signed long long slot = (signed long long) ( i % BENCH_SLOTS );
+
+        // Read, bump, and write under the lock
+        if ( p_slots->mode == 0 )
+        {
+            mutex_lock(&p_slots->_lock);
+            p_slots->p_tuple->_elements[slot] = (char *) p_slots->p_tuple->_elements[slot] + 1;
+            mutex_unlock(&p_slots->_lock);
+        }
+
+        // Publish a new element, last writer wins
+        else if ( p_slots->mode == 1 ) tuple_set(p_slots->p_tuple, slot, (void *) i, memory_order_release);
+
+        // Bump the element, retrying until no other writer got there first
+        else
+        {
+            tuple_index_acquire(p_slots->p_tuple, slot, &expected);
+            while ( tuple_compare_exchange(p_slots->p_tuple, slot, &expected, (char *) expected + 1, memory_order_acq_rel, memory_order_acquire) == false );
+        }
+    }
+
+    // Done
+    return (void *) 0;
+}
+
+int bench_slots ( const char *name, size_t threads, int mode )
+{
+
+    // Initialized data
+    struct bench_slots_s  slots                       = { .mode = mode };
+    pthread_t             _threads[BENCH_MAX_THREADS] = { 0 };
+    void                 *_p_zero[BENCH_SLOTS]        = { 0 };
+    timestamp             t0                          = 0,
+                          t1                          = 0;
+
+    // Construct the shared tuple, and its lock
+    tuple_from_elements(&slots.p_tuple, _p_zero, BENCH_SLOTS);
+    mutex_create(&slots._lock);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Every thread writes every slot
+    for (size_t i = 0; i < threads; i++) pthread_create(&_threads[i], 0, bench_slot_writer, &slots);
+    for (size_t i = 0; i < threads; i++) pthread_join(_threads[i], 0);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report wall time per update across every thread
+    print_bench(name, threads, threads * BENCH_ITERATIONS, 0, t1 - t0);
+
+    // Clean up
+    tuple_destroy(&slots.p_tuple);
+    mutex_destroy(&slots._lock);
+
+    // Success
+    return 1;
+}
+
+bool bench_is_missing ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // Match the element no tuple holds
+    return value == (void *) bench_find_missing;
+}
+
+int bench_find ( const char *name, size_t arity, int mode )
+{
+
+    // Initialized data
+    tuple         *p_tuple    = 0;
+    tuple_builder *p_builder  = 0;
+    size_t         iterations = BENCH_ITERATIONS * 16 / arity,
+                   found      = 0,
+                   index      = 0;
+    timestamp      t0         = 0,
+                   t1         = 0;
+
+    // Fill the tuple with elements that never match
+    if ( tuple_builder_create(&p_builder, arity) == 0 ) return 0;
+    for (size_t i = 0; i < arity; i++) tuple_builder_push(p_builder, bench_elements[i & 15]);
+    tuple_builder_freeze(p_builder, &p_tuple);
+    tuple_builder_destroy(&p_builder);
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Look for an element that isn't there, so every search scans the whole tuple
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // One element at a time
+        if ( mode == 0 )
+        {
+
+            // Initialized data
+            void *p_value = 0;
+
+            // Scan
+            for (size_t j = 0; j < arity; j++)
+            {
+                tuple_index(p_tuple, (signed) j, &p_value);
+                if ( p_value == (void *) bench_find_missing ) { found++; break; }
+            }
+        }
+
+        // Vector compares
+        else if ( mode == 1 ) found += tuple_find(p_tuple, bench_find_missing, &index);
+        else if ( mode == 2 ) found += tuple_count(p_tuple, bench_find_missing);
+
+        // Predicate
+        else found += tuple_find_if(p_tuple, bench_is_missing, &index);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, iterations, 0, t1 - t0);
+
+    // Nothing was found
+    if ( found ) log_warning("Mismatch\n");
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+
+    // Success
+    return 1;
+}
+
+int bench_gather ( const char *name, size_t fields, bool use_many )
+{
+
+    // Initialized data
+    tuple            *p_tuple    = 0;
+    tuple_builder    *p_builder  = 0;
+    signed long long *p_indices  = TUPLE_REALLOC(0, fields * sizeof(signed long long));
+    void            **p_values   = TUPLE_REALLOC(0, fields * sizeof(void *));
+    size_t            iterations = BENCH_ITERATIONS * 4 / fields,
+                      checksum   = 0;
+    timestamp         t0         = 0,
+                      t1         = 0;
+
+    // Error check
+    if ( p_indices == (void *) 0 || p_values == (void *) 0 ) return 0;
+
+    // A wide record
+    if ( tuple_builder_create(&p_builder, BENCH_WIDE_SIZE) == 0 ) return 0;
+    for (size_t i = 0; i < BENCH_WIDE_SIZE; i++) tuple_builder_push(p_builder, bench_elements[i & 15]);
+    tuple_builder_freeze(p_builder, &p_tuple);
+    tuple_builder_destroy(&p_builder);
+
+    // Scattered fields, half of them counted from the end
+    for (size_t i = 0; i < fields; i++) p_indices[i] = ( i & 1 ) ? -(signed long long) ( ( i * 2654435761u ) % BENCH_WIDE_SIZE + 1 ) : (signed long long) ( ( i * 2654435761u ) % BENCH_WIDE_SIZE );
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Project the fields, over and over
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // One call for the batch
+        if ( use_many ) tuple_index_many(p_tuple, p_indices, fields, p_values);
+
+        // One call per field
+        else for (size_t j = 0; j < fields; j++) tuple_index(p_tuple, p_indices[j], &p_values[j]);
+
+        // Use the result
+        checksum += (size_t) p_values[i % fields];
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, fields, iterations, 0, t1 - t0);
+
+    // Keep the loop
+    if ( checksum == 0 ) log_warning("Mismatch\n");
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    p_indices = TUPLE_REALLOC(p_indices, 0);
+    p_values  = TUPLE_REALLOC(p_values, 0);
+
+    // Success
+    return 1;
+}
+
+int bench_concat ( const char *name, size_t arity, bool use_concat )
+{
+
+    // Initialized data
+    tuple         *_p_parts[4] = { 0 },
+                  *p_result    = 0;
+    tuple_builder *p_builder   = 0;
+    size_t         iterations  = BENCH_ITERATIONS * 4 / arity;
+    timestamp      t0          = 0,
+                   t1          = 0;
+
+    // Four parts
+    for (size_t i = 0; i < 4; i++)
+    {
+        if ( tuple_builder_create(&p_builder, arity) == 0 ) return 0;
+        for (size_t j = 0; j < arity; j++) tuple_builder_push(p_builder, bench_elements[( i + j ) & 15]);
+        tuple_builder_freeze(p_builder, &_p_parts[i]);
+        tuple_builder_destroy(&p_builder);
+    }
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Join the parts, over and over
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // One allocation, one copy
+        if ( use_concat ) tuple_concat((const tuple *const *) _p_parts, 4, &p_result);
+
+        // Slice each part into a buffer, then copy the buffer
+        else
+        {
+
+            // Initialized data
+            const void **pp_scratch = TUPLE_REALLOC(0, 4 * arity * sizeof(void *));
+
+            // Slice
+            for (size_t j = 0; j < 4; j++) tuple_slice(_p_parts[j], &pp_scratch[j * arity], 0, (signed long long) arity - 1);
+
+            // Construct
+            tuple_from_elements(&p_result, (void *const *) pp_scratch, 4 * arity);
+
+            // Free the buffer
+            pp_scratch = TUPLE_REALLOC(pp_scratch, 0);
+        }
+
+        // Done with it
+        tuple_destroy(&p_result);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity * 4, iterations, allocator_calls, t1 - t0);
+
+    // Clean up
+    for (size_t i = 0; i < 4; i++) tuple_destroy(&_p_parts[i]);
+
+    // Success
+    return 1;
+}
+
+int bench_project ( const char *name, size_t rows, int mode )
+{
+
+    // Initialized data
+    tuple            **pp_rows      = TUPLE_REALLOC(0, rows * sizeof(tuple *)),
+                     **pp_results   = 0,
+                      *p_result     = 0;
+    signed long long   _fields[4]   = { 1, 5, -1, 9 };
+    void              *_p_values[4] = { 0 };
+    size_t             iterations   = BENCH_ITERATIONS / rows;
+    timestamp          t0           = 0,
+                       t1           = 0;
+
+    // Error check
+    if ( pp_rows == (void *) 0 ) return 0;
+
+    // Rows of 16 fields
+    for (size_t i = 0; i < rows; i++) tuple_from_elements(&pp_rows[i], &bench_elements[0], 16);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Project every row, over and over
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // One block for every row
+        if ( mode == 2 )
+        {
+            tuple_project_batch((const tuple *const *) pp_rows, rows, _fields, 4, &pp_results);
+            tuple_destroy_batch(&pp_results);
+            continue;
+        }
+
+        // One row at a time
+        for (size_t j = 0; j < rows; j++)
+        {
+
+            // Gather into the result
+            if ( mode == 1 ) tuple_project(pp_rows[j], _fields, 4, &p_result);
+
+            // Index each field, then copy them
+            else
+            {
+                for (size_t k = 0; k < 4; k++) tuple_index(pp_rows[j], _fields[k], &_p_values[k]);
+                tuple_from_elements(&p_result, _p_values, 4);
+            }
+
+            // Done with it
+            tuple_destroy(&p_result);
+        }
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report per row
+    print_bench(name, 4, iterations * rows, allocator_calls, t1 - t0);
+
+    // Clean up
+    for (size_t i = 0; i < rows; i++) tuple_destroy(&pp_rows[i]);
+    pp_rows = TUPLE_REALLOC(pp_rows, 0);
+
+    // Success
+    return 1;
+}
+
+void *bench_stage_scale ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // 3x
+    return (void *) ( (size_t) value * 3 );
+}
+
+bool bench_stage_keep ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // Keep half
+    return ( (size_t) value & 1 ) == 0;
+}
+
+void bench_stage_map ( void *const value, size_t index )
+{
+
+    // Write the mapped element to the side buffer
+    bench_stage_buffer[index] = bench_stage_scale(value, index);
+}
+
+void bench_stage_filter ( void *const value, size_t index )
+{
+
+    // Append the kept element to the side buffer
+    if ( bench_stage_keep(value, index) ) bench_stage_buffer[bench_stage_kept++] = value;
+}
+
+int bench_pipeline ( const char *name, size_t arity, bool use_pipeline )
+{
+
+    // Initialized data
+    tuple          *p_tuple    = 0,
+                   *p_stage    = 0,
+                   *p_result   = 0;
+    tuple_builder  *p_builder  = 0;
+    tuple_pipeline *p_pipeline = 0;
+    size_t          iterations = BENCH_ITERATIONS * 16 / arity;
+    timestamp       t0         = 0,
+                    t1         = 0;
+
+    // 0, 1, 2, ...
+    if ( tuple_builder_create(&p_builder, arity) == 0 ) return 0;
+    for (size_t i = 0; i < arity; i++) tuple_builder_push(p_builder, (void *) i);
+    tuple_builder_freeze(p_builder, &p_tuple);
+    tuple_builder_destroy(&p_builder);
+
+    // Record the stages once
+    if ( use_pipeline )
+    {
+        tuple_pipeline_create(&p_pipeline, p_tuple);
+        tuple_pipeline_map(p_pipeline, bench_stage_scale);
+        tuple_pipeline_filter(p_pipeline, bench_stage_keep);
+        tuple_pipeline_map(p_pipeline, bench_stage_scale);
+    }
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // map -> filter -> map, over and over
+    for (size_t i = 0; i < iterations; i++)
+    {
+
+        // One pass, one tuple
+        if ( use_pipeline ) tuple_pipeline_collect(p_pipeline, &p_result);
+
+        // A side buffer and a tuple for each stage
+        else
+        {
+            tuple_foreach(p_tuple, bench_stage_map);
+            tuple_from_elements(&p_stage, bench_stage_buffer, arity);
+            bench_stage_kept = 0;
+            tuple_foreach(p_stage, bench_stage_filter);
+            tuple_destroy(&p_stage);
+            tuple_from_elements(&p_stage, bench_stage_buffer, bench_stage_kept);
+            tuple_foreach(p_stage, bench_stage_map);
+            tuple_from_elements(&p_result, bench_stage_buffer, tuple_size(p_stage));
+            tuple_destroy(&p_stage);
+        }
+
+        // Done with it
+        tuple_destroy(&p_result);
+    }
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report
+    print_bench(name, arity, iterations, allocator_calls, t1 - t0);
+
+    // Clean up
+    if ( use_pipeline ) tuple_pipeline_destroy(&p_pipeline);
+    tuple_destroy(&p_tuple);
+
+    // Success
+    return 1;
+}
+
+int bench_qsort_compare ( const void *a, const void *b )
+{
+
+    // Initialized data
+    void *p_a = 0,
+         *p_b = 0;
+
+    // Reach into each tuple for its key
+    tuple_index(*(tuple *const *) a, 0, &p_a);
+    tuple_index(*(tuple *const *) b, 0, &p_b);
+
+    // Compare the keys
+    return ( (size_t) p_a > (size_t) p_b ) - ( (size_t) p_a < (size_t) p_b );
+}
+
+int bench_sort_compare ( const void *const a, const void *const b )
+{
+
+    // Compare the keys as integers
+    return ( (size_t) a > (size_t) b ) - ( (size_t) a < (size_t) b );
+}
+
+int bench_sort ( const char *name, size_t threads, int mode )
+{
+
+    // Initialized data
+    tuple          **pp_tuples = TUPLE_REALLOC(0, BENCH_SORT_SIZE * sizeof(tuple *));
+    tuple_sort_key   _key      = { .index = 0, .pfn_compare = ( mode == 2 ) ? bench_sort_compare : (void *) 0 };
+    size_t           state     = 88172645463325252ULL;
+    timestamp        t0        = 0,
+                     t1        = 0;
+
+    // Error check
+    if ( pp_tuples == (void *) 0 ) return 0;
+
+    // Rows of ( random 32 bit key, A, B, C )
+    for (size_t i = 0; i < BENCH_SORT_SIZE; i++)
+    {
+
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        // Construct the row
+        tuple_from_arguments(&pp_tuples[i], 4, (void *) ( state & 0xffffffff ), bench_elements[0], bench_elements[1], bench_elements[2]);
+    }
+
+    // Size the pool, and start it outside the timed region
+    tuple_parallel_threads(threads);
+    tuple_array_sort(pp_tuples, BENCH_SORT_SIZE / 64, &_key, 1);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Sort every row by its key
+    if   ( mode == 0 ) qsort(pp_tuples, BENCH_SORT_SIZE, sizeof(tuple *), bench_qsort_compare);
+    else               tuple_array_sort(pp_tuples, BENCH_SORT_SIZE, &_key, 1);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report per row
+    print_bench(name, threads, BENCH_SORT_SIZE, allocator_calls, t1 - t0);
+
+    // Back to the default pool size
+    tuple_parallel_threads(0);
+
+    // Clean up
+    for (size_t i = 0; i < BENCH_SORT_SIZE; i++) tuple_destroy(&pp_tuples[i]);
+    pp_tuples = TUPLE_REALLOC(pp_tuples, 0);
+
+    // Success
+    return 1;
+}
+
+int bench_join ( const char *name, size_t threads, int mode )
+{
+
+    // Initialized data
+    tuple            **pp_left    = TUPLE_REALLOC(0, BENCH_JOIN_LEFT * sizeof(tuple *)),
+                     **pp_right   = TUPLE_REALLOC(0, BENCH_JOIN_RIGHT * sizeof(tuple *)),
+                     **pp_results = 0;
+    tuple_sort_key     _key       = { .index = 0 };
+    signed long long   _index[]   = { 0 };
+    size_t             state      = 88172645463325252ULL,
+                       rows       = ( mode == 3 ) ? BENCH_JOIN_NESTED : BENCH_JOIN_LEFT,
+                       count      = 0;
+    timestamp          t0         = 0,
+                       t1         = 0;
+
+    // Error check
+    if ( pp_left == (void *) 0 || pp_right == (void *) 0 ) return 0;
+
+    // Right rows of ( key, A ), one per key
+    for (size_t i = 0; i < BENCH_JOIN_RIGHT; i++) tuple_from_arguments(&pp_right[i], 2, (void *) ( i * 2654435761 % BENCH_JOIN_RIGHT + 1 ), bench_elements[0]);
+
+    // Left rows of ( random key, B, C ), with about half of the keys on the right
+    for (size_t i = 0; i < BENCH_JOIN_LEFT; i++)
+    {
+
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        // Construct the row
+        tuple_from_arguments(&pp_left[i], 3, (void *) ( state % ( 2 * BENCH_JOIN_RIGHT ) + 1 ), bench_elements[1], bench_elements[2]);
+    }
+
+    // Size the pool, and start it outside the timed region
+    tuple_parallel_threads(threads);
+    tuple_array_sort(pp_right, BENCH_JOIN_RIGHT / 64, &_key, 1);
+
+    // Reset the counter
+    allocator_calls = 0;
+
+    // Start
+    t0 = timer_high_precision();
+
+    // Sort both sides, then walk them together, concatenating each match
+    if ( mode == 0 )
+    {
+
+        // Initialized data
+        size_t r = 0;
+
+        // Sort both sides by key
+        tuple_array_sort(pp_left, BENCH_JOIN_LEFT, &_key, 1);
+        tuple_array_sort(pp_right, BENCH_JOIN_RIGHT, &_key, 1);
+
+        // Room for every left row
+        pp_results = TUPLE_REALLOC(0, BENCH_JOIN_LEFT * sizeof(tuple *));
+
+        // Merge
+        for (size_t l = 0; pp_results && l < BENCH_JOIN_LEFT; l++)
+        {
+
+            // Initialized data
+            void *p_left_key  = 0,
+                 *p_right_key = 0;
+
+            // Advance the right side past smaller keys
+            tuple_index(pp_left[l], 0, &p_left_key);
+            while ( r < BENCH_JOIN_RIGHT && tuple_index(pp_right[r], 0, &p_right_key) && (size_t) p_right_key < (size_t) p_left_key ) r++;
+
+            // Concatenate a match
+            if ( r < BENCH_JOIN_RIGHT && p_right_key == p_left_key )
+                tuple_concat((const tuple *const []) { pp_left[l], pp_right[r] }, 2, &pp_results[count++]);
+        }
+    }
+
+    // Compare every left row with every right row
+    else if ( mode == 3 )
+    {
+
+        // Room for every left row
+        pp_results = TUPLE_REALLOC(0, BENCH_JOIN_LEFT * sizeof(tuple *));
+
+        // Each left row
+        for (size_t l = 0; pp_results && l < rows; l++)
+        {
+
+            // Initialized data
+            void *p_left_key = 0;
+
+            // Get the left key
+            tuple_index(pp_left[l], 0, &p_left_key);
+
+            // Each right row
+            for (size_t r = 0; r < BENCH_JOIN_RIGHT; r++)
+            {
+
+                // Initialized data
+                void *p_right_key = 0;
+
+                // Concatenate a match
+                if ( tuple_index(pp_right[r], 0, &p_right_key) && p_right_key == p_left_key )
+                    tuple_concat((const tuple *const []) { pp_left[l], pp_right[r] }, 2, &pp_results[count++]);
+            }
+        }
+    }
+
+    // Hash join
+    else tuple_join((const tuple *const *) pp_left, BENCH_JOIN_LEFT, (const tuple *const *) pp_right, BENCH_JOIN_RIGHT, _index, _index, 1, ( mode == 2 ) ? TUPLE_JOIN_LEFT : TUPLE_JOIN_INNER, true, &pp_results, &count);
+
+    // Stop
+    t1 = timer_high_precision();
+
+    // Report per left row
+    print_bench(name, threads, rows, allocator_calls, t1 - t0);
+
+    // Back to the default pool size
+    tuple_parallel_threads(0);
+
+    // Clean up
+    if ( mode == 0 || mode == 3 ) for (size_t i = 0; i < count; i++) tuple_destroy(&pp_results[i]);
+    if ( ( mode == 0 || mode == 3 ) && pp_results ) pp_results = TUPLE_REALLOC(pp_results, 0);
+    if ( ( mode == 1 || mode == 2 ) && pp_results ) tuple_destroy_batch(&pp_results);
+    for (size_t i = 0; i < BENCH_JOIN_LEFT; i++) tuple_destroy(&pp_left[i]);
+    for (size_t i = 0; i < BENCH_JOIN_RIGHT; i++) tuple_destroy(&pp_right[i]);
+    pp_left  = TUPLE_REALLOC(pp_left, 0);
+    pp_right = TUPLE_REALLOC(pp_right, 0);
+
+    // Success
+    return 1;
+}
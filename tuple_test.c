@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <pthread.h>
 
 // log module
 #include <log/log.h>
@@ -20,6 +21,7 @@
 
 // tuple
 #include <tuple/tuple.h>
+#include <tuple/tuple_fast.h>
 
 // Possible elements
 char *A_element   = "A",
@@ -67,6 +69,30 @@ int test_empty_tuple         ( int (*tuple_constructor)(tuple **), char  *name )
 int test_one_element_tuple   ( int (*tuple_constructor)(tuple **), char  *name, void **values );
 int test_two_element_tuple   ( int (*tuple_constructor)(tuple **), char  *name, void **values );
 int test_three_element_tuple ( int (*tuple_constructor)(tuple **), char  *name, void **values );
+int test_pool                ( char  *name );
+int test_arena               ( char  *name );
+int test_inline              ( char  *name );
+int test_view                ( char  *name );
+int test_fast                ( char  *name );
+int test_status              ( char  *name );
+int test_shared              ( char  *name );
+int test_epoch               ( char  *name );
+int test_parallel            ( char  *name );
+int test_hash                ( char  *name );
+int test_compare             ( char  *name );
+int test_intern              ( char  *name );
+int test_table               ( char  *name );
+int test_batch               ( char  *name );
+int test_builder             ( char  *name );
+int test_adopt               ( char  *name );
+int test_with                ( char  *name );
+int test_atomic              ( char  *name );
+int test_find                ( char  *name );
+int test_gather              ( char  *name );
+int test_combine             ( char  *name );
+int test_pipeline            ( char  *name );
+int test_sort                ( char  *name );
+int test_join                ( char  *name );
 
 int construct_empty                     ( tuple **pp_tuple );
 int construct_empty_fromelementsABC_ABC ( tuple **pp_tuple );
@@ -124,6 +150,78 @@ int run_tests ( void )
     // ... -> [ A, B, C ]
     test_three_element_tuple(construct_empty_fromelementsABC_ABC, "empty_fromelementsABC_ABC", (void **)ABC_elements);
 
+    // Pool allocator
+    test_pool("pool");
+
+    // Arena allocator
+    test_arena("arena");
+
+    // Inline storage
+    test_inline("inline");
+
+    // Views
+    test_view("view");
+
+    // Inline accessors
+    test_fast("fast");
+
+    // Error codes
+    test_status("status");
+
+    // Reference counting
+    test_shared("shared");
+
+    // Deferred reclamation
+    test_epoch("epoch");
+
+    // Parallel iterators
+    test_parallel("parallel");
+
+    // Hashing
+    test_hash("hash");
+
+    // Comparison
+    test_compare("compare");
+
+    // Interning
+    test_intern("intern");
+
+    // Columnar tables
+    test_table("table");
+
+    // Batch construction
+    test_batch("batch");
+
+    // Builders
+    test_builder("builder");
+
+    // Adopted and borrowed storage
+    test_adopt("adopt");
+
+    // Persistent updates
+    test_with("with");
+
+    // Atomic updates
+    test_atomic("atomic");
+
+    // Searching
+    test_find("find");
+
+    // Gathering
+    test_gather("gather");
+
+    // Concatenation, projection and zipping
+    test_combine("combine");
+
+    // Lazy pipelines
+    test_pipeline("pipeline");
+
+    // Sorting by key columns
+    test_sort("sort");
+
+    // Hash joins
+    test_join("join");
+
     // Success
     return 1;
 }
@@ -359,6 +457,8 @@ int test_three_element_tuple ( int (*tuple_constructor)(tuple **pp_tuple), char
     print_test(name, "tuple_index1"   , test_index(tuple_constructor, 1, values[1], match) );  
     print_test(name, "tuple_index2"   , test_index(tuple_constructor, 2, values[2], match) );  
     print_test(name, "tuple_index3"   , test_index(tuple_constructor, 3, (void *)0, zero) );  
+    print_test(name, "tuple_index4"   , test_index(tuple_constructor, 4, (void *)0, zero) );  
+    print_test(name, "tuple_index-4"  , test_index(tuple_constructor, -4, (void *)0, zero) );  
     
     // Output
     print_final_summary();
@@ -367,6 +467,3395 @@ int test_three_element_tuple ( int (*tuple_constructor)(tuple **pp_tuple), char
     return 1;
 }
 
+bool test_pool_reuse ( size_t size )
+{
+
+    // Initialized data
+    tuple *p_tuple  = 0;
+    void  *p_before = 0;
+    bool   result   = false;
+
+    // Construct, remember and destroy a tuple
+    if ( tuple_construct(&p_tuple, size) == 0 ) return false;
+    p_before = p_tuple;
+    tuple_destroy(&p_tuple);
+
+    // The next tuple of the same arity should reuse the block
+    if ( tuple_construct(&p_tuple, size) == 0 ) return false;
+
+    // Match if the block was reused
+    result = ( (void *) p_tuple == p_before );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_pool_large ( void )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    void  *value   = 0;
+    bool   result  = false;
+
+    // Too large for any size class, so the tuple comes from the heap
+    if ( tuple_construct(&p_tuple, 100000) == 0 ) return false;
+
+    // Elements are zeroed
+    result = ( tuple_size(p_tuple) == 100000 ) && tuple_index(p_tuple, -1, &value) && ( value == (void *) 0 );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_pool_reset ( tuple_pool *p_pool )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+
+    // Draw a tuple, then reset the pool underneath it
+    if ( tuple_from_elements(&p_tuple, (void **)ABC_elements, 3) == 0 ) return false;
+    if ( tuple_pool_reset(p_pool) == 0 ) return false;
+
+    // The pool still serves tuples after a reset
+    if ( tuple_from_elements(&p_tuple, (void **)AB_elements, 2) == 0 ) return false;
+
+    // Return result
+    return ( tuple_size(p_tuple) == 2 ) && tuple_destroy(&p_tuple);
+}
+
+void *pool_exit_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    void  **pp_blocks = p_parameter;
+    tuple  *p_tuple   = 0;
+
+    // Attach, and draw a tuple
+    tuple_pool_attach(pp_blocks[0]);
+    tuple_construct(&p_tuple, 7);
+
+    // Remember its block, and keep it in this thread's cache
+    pp_blocks[1] = p_tuple;
+    tuple_destroy(&p_tuple);
+
+    // Exit without detaching
+    return 0;
+}
+
+bool test_pool_thread_exit ( tuple_pool *p_pool )
+{
+
+    // Initialized data
+    pthread_t  thread        = { 0 };
+    void      *_p_blocks[]   = { p_pool, 0 };
+    tuple     *_p_tuples[64] = { 0 };
+    bool       result        = false;
+
+    // A thread leaves a block in its cache, and exits
+    pthread_create(&thread, 0, pool_exit_worker, _p_blocks);
+    pthread_join(thread, 0);
+
+    // This thread's refill finds the block on the pool's shared free list
+    for (size_t i = 0; i < 64; i++)
+    {
+
+        // Draw a tuple
+        if ( tuple_construct(&_p_tuples[i], 7) == 0 ) break;
+
+        // Match if the block came back
+        result = result || ( (void *) _p_tuples[i] == _p_blocks[1] );
+    }
+
+    // Clean up
+    for (size_t i = 0; i < 64; i++) tuple_destroy(&_p_tuples[i]);
+
+    // Return result
+    return result;
+}
+
+int test_pool ( char *name )
+{
+
+    // Initialized data
+    tuple_pool *p_pool = 0;
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Construct and attach a pool
+    tuple_pool_create(&p_pool);
+    tuple_pool_attach(p_pool);
+
+    // Tests
+    print_test(name, "tuple_size"     , test_size(construct_empty_fromelementsABC_ABC, 3, match));
+    print_test(name, "tuple_index0"   , test_index(construct_empty_fromelementsABC_ABC, 0, A_element, match) );
+    print_test(name, "tuple_index2"   , test_index(construct_empty_fromelementsABC_ABC, 2, C_element, match) );
+    print_test(name, "tuple_index3"   , test_index(construct_empty_fromelementsABC_ABC, 3, (void *)0, zero) );
+    print_test(name, "tuple_empty"    , test_size(construct_empty, 0, match));
+    print_test(name, "tuple_reuse"    , test_pool_reuse(5));
+    print_test(name, "tuple_large"    , test_pool_large());
+    print_test(name, "tuple_reset"    , test_pool_reset(p_pool));
+    print_test(name, "tuple_exit"     , test_pool_thread_exit(p_pool));
+
+    // Detach and destroy the pool
+    tuple_pool_attach(0);
+    tuple_pool_destroy(&p_pool);
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_arena_reset ( tuple_arena *p_arena )
+{
+
+    // Initialized data
+    tuple *p_first  = 0,
+          *p_second = 0;
+    void  *p_before = 0;
+
+    // Start from an empty arena
+    if ( tuple_arena_reset(p_arena) == 0 ) return false;
+
+    // Allocate a couple of tuples
+    if ( tuple_from_elements(&p_first , (void **)AB_elements , 2) == 0 ) return false;
+    if ( tuple_from_elements(&p_second, (void **)ABC_elements, 3) == 0 ) return false;
+
+    // Remember the first one
+    p_before = p_first;
+
+    // Destroying an arena tuple only clears the pointer
+    tuple_destroy(&p_second);
+    if ( p_second != (void *) 0 ) return false;
+
+    // Release everything
+    if ( tuple_arena_reset(p_arena) == 0 ) return false;
+
+    // The next tuple starts over at the front of the arena
+    if ( tuple_from_elements(&p_first, (void **)A_elements, 1) == 0 ) return false;
+
+    // Return result
+    return ( (void *) p_first == p_before ) && ( tuple_size(p_first) == 1 );
+}
+
+bool test_arena_large ( void )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    void  *value   = (void *) 1;
+
+    // Larger than a chunk
+    if ( tuple_construct(&p_tuple, 100000) == 0 ) return false;
+
+    // Return result
+    return ( tuple_size(p_tuple) == 100000 ) && tuple_index(p_tuple, -1, &value) && ( value == (void *) 0 );
+}
+
+int test_arena ( char *name )
+{
+
+    // Initialized data
+    tuple_arena *p_arena = 0;
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Construct and attach an arena
+    tuple_arena_create(&p_arena);
+    tuple_arena_attach(p_arena);
+
+    // Tests
+    print_test(name, "tuple_size"     , test_size(construct_empty_fromelementsABC_ABC, 3, match));
+    print_test(name, "tuple_index0"   , test_index(construct_empty_fromelementsABC_ABC, 0, A_element, match) );
+    print_test(name, "tuple_index2"   , test_index(construct_empty_fromelementsABC_ABC, 2, C_element, match) );
+    print_test(name, "tuple_index3"   , test_index(construct_empty_fromelementsABC_ABC, 3, (void *)0, zero) );
+    print_test(name, "tuple_reset"    , test_arena_reset(p_arena));
+    print_test(name, "tuple_large"    , test_arena_large());
+
+    // Detach and destroy the arena
+    tuple_arena_attach(0);
+    tuple_arena_destroy(&p_arena);
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int construct_inline_ABC ( tuple **pp_tuple )
+{
+
+    // Storage outlives the test
+    static tuple_inline storage;
+
+    // Construct [ A, B, C ] in place
+    tuple_init_inline(pp_tuple, &storage, 3, A_element, B_element, C_element);
+
+    // Success
+    return 1;
+}
+
+bool test_inline_layout ( void )
+{
+
+    // Initialized data
+    tuple        *p_tuple = 0;
+    tuple_inline  storage;
+
+    // Construct a full tuple on the stack
+    if ( tuple_init_inline(&p_tuple, &storage, 6, A_element, B_element, C_element, D_element, X_element, A_element) == 0 ) return false;
+
+    // Return result
+    return ( sizeof(tuple_inline) == 64 ) && ( ( (size_t) p_tuple & 63 ) == 0 ) && ( tuple_size(p_tuple) == 6 );
+}
+
+bool test_inline_too_many ( void )
+{
+
+    // Initialized data
+    tuple        *p_tuple = 0;
+    tuple_inline  storage;
+
+    // One more element than fits
+    return tuple_init_inline(&p_tuple, &storage, TUPLE_INLINE_CAPACITY + 1, A_element, B_element, C_element, D_element, X_element, A_element, B_element, C_element, D_element, X_element, A_element, B_element, C_element, D_element, X_element) == 0;
+}
+
+int test_inline ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_size"     , test_size(construct_inline_ABC, 3, match));
+    print_test(name, "tuple_index0"   , test_index(construct_inline_ABC, 0, A_element, match) );
+    print_test(name, "tuple_index-1"  , test_index(construct_inline_ABC, -1, C_element, match) );
+    print_test(name, "tuple_index3"   , test_index(construct_inline_ABC, 3, (void *)0, zero) );
+    print_test(name, "tuple_slice"    , test_slice(construct_inline_ABC, 1, 2, (void **)BC_elements, match) );
+    print_test(name, "tuple_layout"   , test_inline_layout());
+    print_test(name, "tuple_too_many" , test_inline_too_many());
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_view_index ( signed lower, signed upper, signed idx, void *expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t    result       = 0;
+    tuple      *p_tuple      = 0;
+    tuple_view  view         = { 0 },
+                slice        = { 0 };
+    void       *result_value = 0;
+
+    // Build [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_tuple);
+
+    // View [ lower : upper ], then index it
+    result = (result_t) ( tuple_view_of(p_tuple, &view) && tuple_view_slice(&view, &slice, lower, upper) && tuple_view_index(&slice, idx, &result_value) );
+
+    // Match if the value is expected
+    if ( result == one && result_value == expected_value ) result = match;
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_view_data ( void )
+{
+
+    // Initialized data
+    tuple       *p_tuple = 0;
+    tuple_view   view    = { 0 },
+                 slice   = { 0 };
+    bool         result  = false;
+
+    // Build [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_tuple);
+
+    // View [ B, C ]
+    tuple_view_of(p_tuple, &view);
+    tuple_view_slice(&view, &slice, 1, -1);
+
+    // The view borrows the tuple's storage
+    result = ( slice.length == 2 ) && ( tuple_view_data(&slice) == tuple_data(p_tuple) + 1 ) && ( tuple_view_data(&slice)[1] == C_element );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+int test_view ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_view_index0"      , test_view_index(0, 2, 0, A_element, match) );
+    print_test(name, "tuple_view_index-1"     , test_view_index(0, 2, -1, C_element, match) );
+    print_test(name, "tuple_view_slice_index0", test_view_index(1, 2, 0, B_element, match) );
+    print_test(name, "tuple_view_slice_index2", test_view_index(1, 2, 2, (void *)0, zero) );
+    print_test(name, "tuple_view_slice_neg"   , test_view_index(-2, -1, -2, B_element, match) );
+    print_test(name, "tuple_view_slice_bad"   , test_view_index(2, 1, 0, (void *)0, zero) );
+    print_test(name, "tuple_view_data"        , test_view_data() );
+    print_test(name, "tuple_slice_end"        , test_slice(construct_empty_fromelementsABC_ABC, 1, 3, (void **)BC_elements, zero) );
+    print_test(name, "tuple_slice_bad"        , test_slice(construct_empty_fromelementsABC_ABC, 2, 1, (void **)BC_elements, zero) );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_fast_index ( int(*tuple_constructor)(tuple **pp_tuple), signed idx, void *expected_value, result_t expected )
+{
+
+    // Initialized data
+    result_t  result       = 0;
+    tuple    *p_tuple      = 0;
+    void     *result_value = 0;
+
+    // Build the tuple
+    tuple_constructor(&p_tuple);
+
+    // Index the tuple
+    result = (result_t) tuple_index_fast(p_tuple, idx, &result_value);
+
+    // Match if the value is expected, and agrees with the unchecked accessor
+    if ( result == one && result_value == expected_value && tuple_index_unchecked(p_tuple, idx) == expected_value ) result = match;
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return (result == expected);
+}
+
+bool test_fast_size ( int(*tuple_constructor)(tuple **pp_tuple), size_t expected_size )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    bool   result  = false;
+
+    // Build the tuple
+    tuple_constructor(&p_tuple);
+
+    // Every size accessor agrees
+    result = ( tuple_size_fast(p_tuple)      == expected_size )
+          && ( tuple_size_unchecked(p_tuple) == expected_size )
+          && ( tuple_is_empty_fast(p_tuple)  == ( expected_size == 0 ) )
+          && ( tuple_data_fast(p_tuple)      == tuple_data(p_tuple) );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+int test_fast ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_size_empty"  , test_fast_size(construct_empty, 0) );
+    print_test(name, "tuple_size"        , test_fast_size(construct_empty_fromelementsABC_ABC, 3) );
+    print_test(name, "tuple_index0"      , test_fast_index(construct_empty_fromelementsABC_ABC, 0, A_element, match) );
+    print_test(name, "tuple_index2"      , test_fast_index(construct_empty_fromelementsABC_ABC, 2, C_element, match) );
+    print_test(name, "tuple_index-3"     , test_fast_index(construct_empty_fromelementsABC_ABC, -3, A_element, match) );
+    print_test(name, "tuple_index3"      , test_fast_index(construct_empty_fromelementsABC_ABC, 3, (void *)0, zero) );
+    print_test(name, "tuple_index-4"     , test_fast_index(construct_empty_fromelementsABC_ABC, -4, (void *)0, zero) );
+    print_test(name, "tuple_index_empty" , test_fast_index(construct_empty, 0, (void *)0, zero) );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_status_index ( int(*tuple_constructor)(tuple **pp_tuple), signed idx, tuple_status expected_status )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    void  *value   = 0;
+    bool   result  = false;
+
+    // Build the tuple
+    tuple_constructor(&p_tuple);
+
+    // Start clean
+    tuple_clear_status();
+
+    // Index the tuple, and check why it failed
+    result = ( tuple_index(p_tuple, idx, &value) == 0 ) && ( tuple_last_status() == expected_status );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_status_clear ( void )
+{
+
+    // Initialized data
+    void *value = 0;
+
+    // Fail, then clear
+    tuple_index((void *) 0, 0, &value);
+    if ( tuple_last_status() != TUPLE_STATUS_NO_TUPLE ) return false;
+    tuple_clear_status();
+
+    // Return result
+    return ( tuple_last_status() == TUPLE_STATUS_OK ) && ( tuple_status_string(TUPLE_STATUS_BOUNDS_ERROR) != (void *) 0 );
+}
+
+int test_status ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_index_bounds"   , test_status_index(construct_empty_fromelementsABC_ABC, 3, TUPLE_STATUS_BOUNDS_ERROR) );
+    print_test(name, "tuple_index_empty"    , test_status_index(construct_empty, 0, TUPLE_STATUS_EMPTY) );
+    print_test(name, "tuple_index_negative" , test_status_index(construct_empty_fromelementsABC_ABC, -4, TUPLE_STATUS_BOUNDS_ERROR) );
+    print_test(name, "tuple_status_clear"   , test_status_clear() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_shared_retain ( void )
+{
+
+    // Initialized data
+    tuple      *p_tuple  = 0,
+               *p_shared = 0;
+    tuple_pool *p_pool   = 0;
+    void       *p_before = 0,
+               *value    = 0;
+    bool        result   = false;
+
+    // Draw from a pool, so a freed block is visible as reuse
+    tuple_pool_create(&p_pool);
+    tuple_pool_attach(p_pool);
+
+    // Construct and share [ A, B, C ]
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    tuple_retain(p_tuple);
+    p_shared = p_before = p_tuple;
+
+    // The first owner lets go, the tuple lives on
+    tuple_destroy(&p_tuple);
+    result = tuple_index(p_shared, 2, &value) && ( value == C_element );
+
+    // The last owner lets go, and the block goes back to the pool
+    tuple_release(&p_shared);
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    result = result && ( p_shared == (void *) 0 ) && ( (void *) p_tuple == p_before );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_pool_attach(0);
+    tuple_pool_destroy(&p_pool);
+
+    // Return result
+    return result;
+}
+
+void *shared_reader ( void *p_parameter )
+{
+
+    // Initialized data
+    tuple *p_tuple = p_parameter;
+    void  *value   = 0;
+
+    // Read, then let go
+    tuple_index(p_tuple, 0, &value);
+    tuple_release(&p_tuple);
+
+    // Done
+    return value;
+}
+
+bool test_shared_threads ( void )
+{
+
+    // Initialized data
+    tuple     *p_tuple     = 0;
+    pthread_t  _threads[4] = { 0 };
+    void      *value       = 0;
+    bool       result      = true;
+
+    // Construct [ A, B, C ]
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+
+    // Hand a reference to each reader
+    for (size_t i = 0; i < 4; i++)
+    {
+        tuple_retain(p_tuple);
+        pthread_create(&_threads[i], 0, shared_reader, p_tuple);
+    }
+
+    // Let go of the constructor's reference while the readers run
+    tuple_release(&p_tuple);
+
+    // Every reader saw the tuple
+    for (size_t i = 0; i < 4; i++)
+    {
+        pthread_join(_threads[i], &value);
+        result = result && ( value == A_element );
+    }
+
+    // Return result
+    return result;
+}
+
+int test_shared ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_retain_release", test_shared_retain() );
+    print_test(name, "tuple_shared_threads", test_shared_threads() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_epoch_defer ( void )
+{
+
+    // Initialized data
+    tuple      *p_tuple  = 0;
+    tuple_pool *p_pool   = 0;
+    void       *p_before = 0;
+    bool        result   = false;
+
+    // Draw from a pool, so a freed block is visible as reuse
+    tuple_pool_create(&p_pool);
+    tuple_pool_attach(p_pool);
+
+    // Retire a tuple while this thread is reading
+    tuple_read_enter();
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    p_before = p_tuple;
+    tuple_destroy_deferred(&p_tuple);
+
+    // However often reclamation runs, the tuple outlives the read section
+    for (size_t i = 0; i < 4; i++) tuple_reclaim();
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    result = ( (void *) p_tuple != p_before );
+    tuple_destroy(&p_tuple);
+
+    // Once the reader leaves, the block goes back to the pool
+    tuple_read_exit();
+    for (size_t i = 0; i < 4; i++) tuple_reclaim();
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    result = result && ( (void *) p_tuple == p_before );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_pool_attach(0);
+    tuple_pool_destroy(&p_pool);
+
+    // Return result
+    return result;
+}
+
+void *epoch_exit_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    tuple *p_tuple = p_parameter;
+
+    // Retire the tuple, and exit without reclaiming
+    tuple_destroy_deferred(&p_tuple);
+
+    // Done
+    return 0;
+}
+
+bool test_epoch_thread_exit ( void )
+{
+
+    // Initialized data
+    tuple      *p_tuple  = 0;
+    tuple_pool *p_pool   = 0;
+    pthread_t   thread   = { 0 };
+    void       *p_before = 0;
+    bool        result   = false;
+
+    // Draw from a pool, so a freed block is visible as reuse
+    tuple_pool_create(&p_pool);
+    tuple_pool_attach(p_pool);
+
+    // Another thread retires the tuple, and exits
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    p_before = p_tuple;
+    pthread_create(&thread, 0, epoch_exit_worker, p_tuple);
+    pthread_join(thread, 0);
+
+    // This thread releases what the exited thread left behind
+    for (size_t i = 0; i < 4; i++) tuple_reclaim();
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    result = ( (void *) p_tuple == p_before );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_pool_attach(0);
+    tuple_pool_destroy(&p_pool);
+
+    // Return result
+    return result;
+}
+
+bool test_epoch_unbalanced ( void )
+{
+
+    // Leaving a read section that was never entered is an error
+    return ( tuple_read_exit() == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NOT_READING );
+}
+
+tuple *_Atomic p_epoch_shared = 0;
+
+void *epoch_reader ( void *p_parameter )
+{
+
+    // Initialized data
+    void   *value  = 0;
+    size_t  misses = 0;
+
+    // Unused
+    (void) p_parameter;
+
+    // Read whichever tuple is current
+    for (size_t i = 0; i < 10000; i++)
+    {
+        tuple_read_enter();
+        tuple_index(atomic_load(&p_epoch_shared), 0, &value);
+        misses += ( value != A_element );
+        tuple_read_exit();
+    }
+
+    // Done
+    return (void *) misses;
+}
+
+bool test_epoch_threads ( void )
+{
+
+    // Initialized data
+    tuple     *p_tuple     = 0;
+    pthread_t  _threads[4] = { 0 };
+    void      *misses      = 0;
+    bool       result      = true;
+
+    // Publish [ A, B, C ]
+    tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+    atomic_store(&p_epoch_shared, p_tuple);
+
+    // Start the readers
+    for (size_t i = 0; i < 4; i++) pthread_create(&_threads[i], 0, epoch_reader, 0);
+
+    // Swap in new tuples underneath the readers
+    for (size_t i = 0; i < 2000; i++)
+    {
+        tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+        p_tuple = atomic_exchange(&p_epoch_shared, p_tuple);
+        tuple_destroy_deferred(&p_tuple);
+    }
+
+    // Every read saw a live tuple
+    for (size_t i = 0; i < 4; i++)
+    {
+        pthread_join(_threads[i], &misses);
+        result = result && ( misses == (void *) 0 );
+    }
+
+    // Clean up
+    p_tuple = atomic_exchange(&p_epoch_shared, (tuple *) 0);
+    tuple_destroy_deferred(&p_tuple);
+    for (size_t i = 0; i < 4; i++) tuple_reclaim();
+
+    // Return result
+    return result;
+}
+
+int test_epoch ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_destroy_deferred", test_epoch_defer() );
+    print_test(name, "tuple_read_unbalanced" , test_epoch_unbalanced() );
+    print_test(name, "tuple_epoch_exit"      , test_epoch_thread_exit() );
+    print_test(name, "tuple_epoch_threads"   , test_epoch_threads() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+#define PARALLEL_SIZE 10000
+
+atomic_uint parallel_visits[PARALLEL_SIZE];
+atomic_uint parallel_wrong = 0;
+
+int construct_counting ( tuple **pp_tuple )
+{
+
+    // Initialized data
+    static void *p_elements[PARALLEL_SIZE] = { 0 };
+
+    // Element i is i
+    for (size_t i = 0; i < PARALLEL_SIZE; i++) p_elements[i] = (void *) i;
+
+    // Success
+    return tuple_from_elements(pp_tuple, p_elements, PARALLEL_SIZE);
+}
+
+void parallel_visit ( void *const value, size_t index )
+{
+
+    // Count the visit, and check the element matches its index
+    atomic_fetch_add(&parallel_visits[index], 1);
+    if ( (size_t) value != index ) atomic_fetch_add(&parallel_wrong, 1);
+}
+
+void *parallel_map ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // Sum of elements, plus one for each
+    return (void *) ( (size_t) value + 1 );
+}
+
+void *parallel_sum ( void *const left, void *const right )
+{
+
+    // Add
+    return (void *) ( (size_t) left + (size_t) right );
+}
+
+void parallel_visit_ignore ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) value;
+    (void) index;
+}
+
+void parallel_nested ( void *const value, size_t index )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+
+    // Unused
+    (void) value;
+
+    // A parallel call from inside a parallel call runs on the calling thread
+    if ( index % 1000 == 0 )
+    {
+        tuple_from_elements(&p_tuple, (void **)ABC_elements, 3);
+        tuple_foreach_parallel(p_tuple, parallel_visit_ignore, 1);
+        tuple_destroy(&p_tuple);
+    }
+}
+
+bool test_parallel_foreach ( size_t grain )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    bool   result  = true;
+
+    // Reset the counters
+    for (size_t i = 0; i < PARALLEL_SIZE; i++) atomic_store(&parallel_visits[i], 0);
+    atomic_store(&parallel_wrong, 0);
+
+    // Visit every element
+    construct_counting(&p_tuple);
+    result = tuple_foreach_parallel(p_tuple, parallel_visit, grain);
+
+    // Each element was visited exactly once
+    for (size_t i = 0; i < PARALLEL_SIZE; i++) result = result && ( atomic_load(&parallel_visits[i]) == 1 );
+    result = result && ( atomic_load(&parallel_wrong) == 0 );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_parallel_reduce ( int(*tuple_constructor)(tuple **pp_tuple), size_t expected_value )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    void  *value   = 0;
+    bool   result  = false;
+
+    // Sum the elements
+    tuple_constructor(&p_tuple);
+    result = tuple_reduce_parallel(p_tuple, parallel_map, parallel_sum, (void *) 0, 0, &value) && ( (size_t) value == expected_value );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_parallel_nested ( void )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    bool   result  = false;
+
+    // Completes without deadlock
+    construct_counting(&p_tuple);
+    result = tuple_foreach_parallel(p_tuple, parallel_nested, 16);
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_parallel_no_function ( void )
+{
+
+    // Initialized data
+    tuple *p_tuple = 0;
+    bool   result  = false;
+
+    // A null callback is an error
+    construct_empty_fromelementsABC_ABC(&p_tuple);
+    result = ( tuple_foreach_parallel(p_tuple, 0, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_FUNCTION );
+
+    // Free the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+int test_parallel ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Use more workers than this machine may have processors, so stealing happens
+    tuple_parallel_threads(4);
+
+    // Tests
+    print_test(name, "tuple_foreach_parallel"      , test_parallel_foreach(0) );
+    print_test(name, "tuple_foreach_parallel_grain", test_parallel_foreach(7) );
+    print_test(name, "tuple_foreach_parallel_one"  , test_parallel_foreach(1) );
+    print_test(name, "tuple_reduce_parallel"       , test_parallel_reduce(construct_counting, ( (size_t) PARALLEL_SIZE * ( PARALLEL_SIZE + 1 ) ) / 2) );
+    print_test(name, "tuple_reduce_parallel_empty" , test_parallel_reduce(construct_empty, 0) );
+    print_test(name, "tuple_parallel_nested"       , test_parallel_nested() );
+    print_test(name, "tuple_parallel_no_function"  , test_parallel_no_function() );
+
+    // Back to the default
+    tuple_parallel_threads(0);
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+unsigned long long hash_string ( const void *const value )
+{
+
+    // Initialized data
+    unsigned long long hash = 14695981039346656037ULL;
+
+    // FNV-1a
+    for (const char *p = value; *p; p++) hash = ( hash ^ (unsigned char) *p ) * 1099511628211ULL;
+
+    // Done
+    return hash;
+}
+
+bool test_hash_identity ( void )
+{
+
+    // Initialized data
+    tuple              *p_a    = 0,
+                       *p_b    = 0,
+                       *p_c    = 0,
+                       *p_d    = 0;
+    void               *_p_cba[] = { C_element, B_element, A_element },
+                       *_p_abc[] = { A_element, B_element, C_element };
+    unsigned long long  a      = 0,
+                        b      = 0,
+                        c      = 0,
+                        cached = 0;
+    bool                result = false;
+
+    // [ A, B, C ] twice, and [ C, B, A ]
+    tuple_from_elements(&p_a, (void **)ABC_elements, 3);
+    tuple_from_elements(&p_b, (void **)ABC_elements, 3);
+    tuple_from_elements(&p_c, _p_cba, 3);
+
+    // Same pointers hash the same, in a different order they hash differently
+    result = tuple_hash(p_a, 0, &a) && tuple_hash(p_b, 0, &b) && tuple_hash(p_c, 0, &c) && ( a == b ) && ( a != c );
+
+    // The second call is served from the cache, even once the borrowed array has changed
+    result = result && tuple_hash(p_a, 0, &cached) && ( cached == a );
+    result = result && tuple_borrow(&p_d, _p_abc, 3) && tuple_hash(p_d, 0, &cached) && ( cached == a );
+    _p_abc[1] = X_element;
+    result = result && tuple_hash(p_d, 0, &cached) && ( cached == a );
+
+    // Clean up
+    tuple_destroy(&p_a);
+    tuple_destroy(&p_b);
+    tuple_destroy(&p_c);
+    tuple_destroy(&p_d);
+
+    // Return result
+    return result;
+}
+
+bool test_hash_content ( void )
+{
+
+    // Initialized data
+    tuple              *p_a    = 0,
+                       *p_b    = 0;
+    char                _a[]   = "A",
+                        _b[]   = "B";
+    unsigned long long  a      = 0,
+                        b      = 0;
+    bool                result = false;
+
+    // Same contents, different pointers
+    tuple_from_arguments(&p_a, 2, A_element, B_element);
+    tuple_from_arguments(&p_b, 2, _a, _b);
+
+    // Content hashes match
+    result = tuple_hash(p_a, hash_string, &a) && tuple_hash(p_b, hash_string, &b) && ( a == b );
+
+    // Identity hashes do not
+    result = result && tuple_hash(p_a, 0, &a) && tuple_hash(p_b, 0, &b) && ( a != b );
+
+    // Clean up
+    tuple_destroy(&p_a);
+    tuple_destroy(&p_b);
+
+    // Return result
+    return result;
+}
+
+bool test_hash_wide ( void )
+{
+
+    // Initialized data
+    tuple              *p_a    = 0,
+                       *p_b    = 0;
+    unsigned long long  a      = 0,
+                        b      = 0;
+    bool                result = false;
+
+    // Wide enough for the striped loop, differing in one element
+    construct_counting(&p_a);
+    construct_counting(&p_b);
+    ((void **) tuple_data(p_b))[4096] = (void *) 1;
+
+    // Hashes differ
+    result = tuple_hash(p_a, 0, &a) && tuple_hash(p_b, 0, &b) && ( a != b );
+
+    // Clean up
+    tuple_destroy(&p_a);
+    tuple_destroy(&p_b);
+
+    // Return result
+    return result;
+}
+
+bool test_hash_no_tuple ( void )
+{
+
+    // Initialized data
+    unsigned long long hash = 0;
+
+    // A null tuple is an error
+    return ( tuple_hash(0, 0, &hash) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+}
+
+int test_hash ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_hash_identity", test_hash_identity() );
+    print_test(name, "tuple_hash_content" , test_hash_content() );
+    print_test(name, "tuple_hash_wide"    , test_hash_wide() );
+    print_test(name, "tuple_hash_no_tuple", test_hash_no_tuple() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int compare_string ( const void *const a, const void *const b )
+{
+
+    // Order by content
+    return strcmp(a, b);
+}
+
+bool test_compare_identity ( void )
+{
+
+    // Initialized data
+    tuple *p_abc    = 0,
+          *p_abc2   = 0,
+          *p_ab     = 0,
+          *p_abd    = 0;
+    bool   result   = false;
+
+    // [ A, B, C ] twice, [ A, B ], and [ A, B, D ]
+    tuple_from_elements(&p_abc , (void **)ABC_elements, 3);
+    tuple_from_elements(&p_abc2, (void **)ABC_elements, 3);
+    tuple_from_elements(&p_ab  , (void **)AB_elements , 2);
+    tuple_from_arguments(&p_abd, 3, A_element, B_element, D_element);
+
+    // Equal, and unequal on size or on content
+    result = tuple_equals(p_abc, p_abc2, 0) && !tuple_equals(p_abc, p_ab, 0) && !tuple_equals(p_abc, p_abd, 0);
+
+    // A prefix orders first, and the order is antisymmetric
+    result = result && ( tuple_compare(p_abc, p_abc2, 0) == 0 )
+                    && ( tuple_compare(p_ab , p_abc , 0) <  0 )
+                    && ( tuple_compare(p_abc, p_ab  , 0) >  0 )
+                    && ( ( tuple_compare(p_abc, p_abd, 0) < 0 ) == ( tuple_compare(p_abd, p_abc, 0) > 0 ) );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_abc2);
+    tuple_destroy(&p_ab);
+    tuple_destroy(&p_abd);
+
+    // Return result
+    return result;
+}
+
+bool test_compare_content ( void )
+{
+
+    // Initialized data
+    tuple *p_a    = 0,
+          *p_b    = 0,
+          *p_c    = 0;
+    char   _a[]   = "A",
+           _b[]   = "B";
+    bool   result = false;
+
+    // Same contents at different addresses, and [ A, C ]
+    tuple_from_arguments(&p_a, 2, A_element, B_element);
+    tuple_from_arguments(&p_b, 2, _a, _b);
+    tuple_from_arguments(&p_c, 2, A_element, C_element);
+
+    // Equal by content, not by address
+    result = tuple_equals(p_a, p_b, compare_string) && !tuple_equals(p_a, p_b, 0);
+
+    // Ordered by content
+    result = result && ( tuple_compare(p_b, p_c, compare_string) < 0 ) && ( tuple_compare(p_c, p_b, compare_string) > 0 );
+
+    // Clean up
+    tuple_destroy(&p_a);
+    tuple_destroy(&p_b);
+    tuple_destroy(&p_c);
+
+    // Return result
+    return result;
+}
+
+bool test_compare_wide ( void )
+{
+
+    // Initialized data
+    tuple *p_a    = 0,
+          *p_b    = 0;
+    bool   result = false;
+
+    // Differ in one element, past the first few blocks
+    construct_counting(&p_a);
+    construct_counting(&p_b);
+    ((void **) tuple_data(p_b))[1001] = (void *) 5000;
+
+    // Element 1001 decides
+    result = !tuple_equals(p_a, p_b, 0) && ( tuple_compare(p_a, p_b, 0) < 0 ) && ( tuple_compare(p_b, p_a, 0) > 0 );
+
+    // Clean up
+    tuple_destroy(&p_a);
+    tuple_destroy(&p_b);
+
+    // Return result
+    return result;
+}
+
+bool test_compare_view ( void )
+{
+
+    // Initialized data
+    tuple      *p_abc  = 0,
+               *p_bc   = 0;
+    tuple_view  abc    = { 0 },
+                bc     = { 0 },
+                tail   = { 0 };
+    bool        result = false;
+
+    // [ A, B, C ] and [ B, C ]
+    tuple_from_elements(&p_abc, (void **)ABC_elements, 3);
+    tuple_from_arguments(&p_bc, 2, B_element, C_element);
+
+    // The last two elements of [ A, B, C ] equal [ B, C ]
+    tuple_view_of(p_abc, &abc);
+    tuple_view_of(p_bc, &bc);
+    tuple_view_slice(&abc, &tail, 1, 2);
+    result = tuple_view_equals(&tail, &bc, 0) && ( tuple_view_compare(&tail, &bc, compare_string) == 0 ) && !tuple_view_equals(&abc, &bc, 0);
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_bc);
+
+    // Return result
+    return result;
+}
+
+bool test_compare_no_tuple ( void )
+{
+
+    // A null tuple is an error
+    return ( tuple_equals(0, 0, 0) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+}
+
+int test_compare ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_compare_identity", test_compare_identity() );
+    print_test(name, "tuple_compare_content" , test_compare_content() );
+    print_test(name, "tuple_compare_wide"    , test_compare_wide() );
+    print_test(name, "tuple_compare_view"    , test_compare_view() );
+    print_test(name, "tuple_compare_no_tuple", test_compare_no_tuple() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_intern_identity ( void )
+{
+
+    // Initialized data
+    tuple_intern_table *p_table = 0;
+    tuple              *p_a     = 0,
+                       *p_b     = 0,
+                       *p_c     = 0;
+    bool                result  = false;
+
+    // Construct a table
+    if ( tuple_intern_table_create(&p_table, 0, 0) == 0 ) return false;
+
+    // [ A, B, C ] twice, and [ A, B ]
+    tuple_intern(p_table, (void **)ABC_elements, 3, &p_a);
+    tuple_intern(p_table, (void **)ABC_elements, 3, &p_b);
+    tuple_intern(p_table, (void **)AB_elements , 2, &p_c);
+
+    // Equal elements share one tuple
+    result = ( p_a == p_b ) && ( p_a != p_c ) && ( tuple_size(p_a) == 3 ) && tuple_equals(p_a, p_b, 0);
+
+    // Callers' references outlive the table
+    tuple_intern_table_destroy(&p_table);
+    result = result && ( p_table == 0 ) && ( tuple_size(p_a) == 3 );
+
+    // Clean up
+    tuple_release(&p_a);
+    tuple_release(&p_b);
+    tuple_release(&p_c);
+
+    // Return result
+    return result;
+}
+
+bool test_intern_content ( void )
+{
+
+    // Initialized data
+    tuple_intern_table *p_table   = 0;
+    tuple              *p_a       = 0,
+                       *p_b       = 0;
+    char                _a[]      = "A",
+                        _b[]      = "B";
+    void               *_p_ab[]   = { _a, _b },
+                       *value     = 0;
+    bool                result    = false;
+
+    // Construct a table that compares strings
+    if ( tuple_intern_table_create(&p_table, hash_string, compare_string) == 0 ) return false;
+
+    // Same contents at different addresses
+    tuple_intern(p_table, (void **)AB_elements, 2, &p_a);
+    tuple_intern(p_table, _p_ab, 2, &p_b);
+
+    // One tuple, holding the first elements interned
+    result = ( p_a == p_b ) && tuple_index(p_b, 0, &value) && ( value == A_element );
+
+    // Clean up
+    tuple_release(&p_a);
+    tuple_release(&p_b);
+    tuple_intern_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+bool test_intern_collect ( void )
+{
+
+    // Initialized data
+    tuple_intern_table *p_table = 0;
+    tuple              *p_kept  = 0,
+                       *p_gone  = 0,
+                       *p_again = 0;
+    bool                result  = false;
+
+    // Construct a table
+    if ( tuple_intern_table_create(&p_table, 0, 0) == 0 ) return false;
+
+    // Keep one tuple, and let go of another
+    tuple_intern(p_table, (void **)ABC_elements, 3, &p_kept);
+    tuple_intern(p_table, (void **)AB_elements , 2, &p_gone);
+    tuple_release(&p_gone);
+
+    // Collect, then intern the kept tuple again
+    result = tuple_intern_collect(p_table) && tuple_intern(p_table, (void **)ABC_elements, 3, &p_again) && ( p_again == p_kept );
+
+    // The collected tuple comes back, as a new canonical tuple
+    result = result && tuple_intern(p_table, (void **)AB_elements, 2, &p_gone) && ( tuple_size(p_gone) == 2 );
+
+    // Clean up
+    tuple_release(&p_kept);
+    tuple_release(&p_again);
+    tuple_release(&p_gone);
+    tuple_intern_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+bool test_intern_pool ( void )
+{
+
+    // Initialized data
+    tuple_intern_table *p_table = 0;
+    tuple_pool         *p_pool  = 0;
+    tuple              *p_a     = 0,
+                       *p_b     = 0;
+    bool                result  = false;
+
+    // Construct a table, and a pool
+    if ( tuple_intern_table_create(&p_table, 0, 0) == 0 ) return false;
+    if ( tuple_pool_create(&p_pool) == 0 ) return false;
+
+    // Intern with the pool attached, then throw the pool away
+    tuple_pool_attach(p_pool);
+    result = tuple_intern(p_table, (void **)ABC_elements, 3, &p_a);
+    tuple_pool_attach(0);
+    tuple_pool_destroy(&p_pool);
+
+    // The canonical tuple is still there
+    result = result && tuple_intern(p_table, (void **)ABC_elements, 3, &p_b) && ( p_a == p_b ) && ( tuple_size(p_b) == 3 );
+
+    // Clean up
+    tuple_release(&p_a);
+    tuple_release(&p_b);
+    tuple_intern_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+void *intern_worker ( void *p_parameter )
+{
+
+    // Initialized data
+    tuple_intern_table *p_table    = p_parameter;
+    tuple              *_p_seen[64] = { 0 };
+    size_t              misses     = 0;
+
+    // Intern 64 keys, many times over
+    for (size_t i = 0; i < 64 * 100; i++)
+    {
+
+        // Initialized data
+        void  *_p_key[2] = { (void *) ( i & 63 ), (void *) 7 };
+        tuple *p_tuple   = 0;
+
+        // Intern
+        tuple_intern(p_table, _p_key, 2, &p_tuple);
+
+        // The same key always gives the same tuple
+        if ( _p_seen[i & 63] == 0 ) _p_seen[i & 63] = p_tuple, tuple_retain(p_tuple);
+        misses += ( _p_seen[i & 63] != p_tuple );
+
+        // Let go
+        tuple_release(&p_tuple);
+    }
+
+    // Hand back one tuple, so the threads can be checked against each other
+    for (size_t i = 1; i < 64; i++) tuple_release(&_p_seen[i]);
+
+    // Done
+    return ( misses ) ? (void *) 0 : _p_seen[0];
+}
+
+bool test_intern_threads ( void )
+{
+
+    // Initialized data
+    tuple_intern_table *p_table     = 0;
+    pthread_t           _threads[4] = { 0 };
+    tuple              *_p_first[4] = { 0 };
+    bool                result      = true;
+
+    // Construct a table
+    if ( tuple_intern_table_create(&p_table, 0, 0) == 0 ) return false;
+
+    // Race four threads over the same keys
+    for (size_t i = 0; i < 4; i++) pthread_create(&_threads[i], 0, intern_worker, p_table);
+    for (size_t i = 0; i < 4; i++) pthread_join(_threads[i], (void **) &_p_first[i]);
+
+    // Every thread got the same canonical tuple
+    for (size_t i = 0; i < 4; i++) result = result && ( _p_first[i] != 0 ) && ( _p_first[i] == _p_first[0] );
+
+    // Clean up
+    for (size_t i = 0; i < 4; i++) tuple_release(&_p_first[i]);
+    tuple_intern_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+int test_intern ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_intern_identity", test_intern_identity() );
+    print_test(name, "tuple_intern_content" , test_intern_content() );
+    print_test(name, "tuple_intern_collect" , test_intern_collect() );
+    print_test(name, "tuple_intern_pool"    , test_intern_pool() );
+    print_test(name, "tuple_intern_threads" , test_intern_threads() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+int construct_table_ABC ( tuple_table **pp_table )
+{
+
+    // Construct a table of three columns
+    if ( tuple_table_create(pp_table, 3) == 0 ) return 0;
+
+    // Rows [ A, B, C ], then [ D, X, A ] a hundred times over, so the columns move as they grow
+    tuple_table_append(*pp_table, (void **)ABC_elements, 0);
+    for (size_t i = 0; i < 100; i++) tuple_table_append(*pp_table, (void *[]) { D_element, X_element, A_element }, 0);
+
+    // Success
+    return 1;
+}
+
+bool test_table_index ( signed long long row, signed long long idx, void *expected_value, result_t expected )
+{
+
+    // Initialized data
+    tuple_table *p_table = 0;
+    tuple_row    handle  = { 0 };
+    void        *value   = 0;
+    result_t     result  = zero;
+
+    // Build the table
+    construct_table_ABC(&p_table);
+
+    // Index the row
+    result = ( tuple_table_row(p_table, row, &handle) && tuple_row_index(&handle, idx, &value) ) ? ( value == expected_value ) ? match : one : zero;
+
+    // Free the table
+    tuple_table_destroy(&p_table);
+
+    // Return result
+    return ( result == expected );
+}
+
+bool test_table_column ( void )
+{
+
+    // Initialized data
+    tuple_table  *p_table  = 0;
+    void *const  *p_column = 0;
+    bool          result   = true;
+
+    // Build the table
+    construct_table_ABC(&p_table);
+
+    // The middle column holds B, then X for every other row
+    p_column = tuple_table_column(p_table, 1);
+    result   = ( p_column != 0 ) && ( tuple_table_size(p_table) == 101 ) && ( tuple_table_arity(p_table) == 3 ) && ( p_column[0] == B_element );
+    for (size_t i = 1; i < tuple_table_size(p_table); i++) result = result && ( p_column[i] == X_element );
+
+    // No fourth column
+    result = result && ( tuple_table_column(p_table, 3) == 0 );
+
+    // Free the table
+    tuple_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+bool test_table_slice ( void )
+{
+
+    // Initialized data
+    tuple_table *p_table     = 0;
+    tuple_row    handle      = { 0 };
+    const void  *_p_slice[2] = { 0 };
+    bool         result      = false;
+
+    // Build the table
+    construct_table_ABC(&p_table);
+
+    // [ B, C ] from the first row, and nothing past the last column
+    tuple_table_row(p_table, 0, &handle);
+    result = tuple_row_slice(&handle, _p_slice, 1, 2) && ( _p_slice[0] == B_element ) && ( _p_slice[1] == C_element );
+    result = result && ( tuple_row_slice(&handle, _p_slice, 1, 3) == 0 );
+
+    // Free the table
+    tuple_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+bool test_table_convert ( void )
+{
+
+    // Initialized data
+    tuple_table *p_table = 0;
+    tuple       *p_abc   = 0,
+                *p_row   = 0,
+                *p_ab    = 0;
+    tuple_row    handle  = { 0 };
+    size_t       row     = 0;
+    bool         result  = false;
+
+    // Build the table, and [ A, B, C ]
+    construct_table_ABC(&p_table);
+    tuple_from_elements(&p_abc, (void **)ABC_elements, 3);
+    tuple_from_elements(&p_ab , (void **)AB_elements , 2);
+
+    // Tuple to row, then row to tuple
+    result = tuple_table_append_tuple(p_table, p_abc, &row) && ( row == 101 ) && tuple_table_row(p_table, -1, &handle) && tuple_row_to_tuple(&handle, &p_row) && tuple_equals(p_abc, p_row, 0);
+
+    // Sizes must match
+    result = result && ( tuple_table_append_tuple(p_table, p_ab, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_ARITY_MISMATCH );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_row);
+    tuple_destroy(&p_ab);
+    tuple_table_destroy(&p_table);
+
+    // Return result
+    return result;
+}
+
+int test_table ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_row_index0"     , test_table_index(0, 0, A_element, match) );
+    print_test(name, "tuple_row_index2"     , test_table_index(0, 2, C_element, match) );
+    print_test(name, "tuple_row_index-1"    , test_table_index(-1, -1, A_element, match) );
+    print_test(name, "tuple_row_index3"     , test_table_index(0, 3, (void *)0, zero) );
+    print_test(name, "tuple_table_row101"   , test_table_index(101, 0, (void *)0, zero) );
+    print_test(name, "tuple_table_column"   , test_table_column() );
+    print_test(name, "tuple_row_slice"      , test_table_slice() );
+    print_test(name, "tuple_table_convert"  , test_table_convert() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_batch_contents ( void )
+{
+
+    // Initialized data
+    tuple      **p_tuples    = 0;
+    void        *elements[5] = { A_element, B_element, C_element, A_element, B_element };
+    size_t       sizes[3]    = { 3, 0, 2 };
+    const void  *_p_ab[2]    = { 0 };
+    bool         result      = false;
+
+    // [ A, B, C ], [ ], [ A, B ]
+    result = tuple_from_elements_batch(&p_tuples, elements, sizes, 3);
+
+    // Check each tuple
+    result = result && ( tuple_size(p_tuples[0]) == 3 ) && ( tuple_data(p_tuples[0])[2] == C_element );
+    result = result && tuple_is_empty(p_tuples[1]);
+    result = result && tuple_slice(p_tuples[2], _p_ab, 0, 1) && ( _p_ab[0] == A_element ) && ( _p_ab[1] == B_element );
+
+    // Free the batch
+    result = result && tuple_destroy_batch(&p_tuples) && ( p_tuples == 0 );
+
+    // Return result
+    return result;
+}
+
+bool test_batch_layout ( void )
+{
+
+    // Initialized data
+    tuple **p_tuples    = 0;
+    void   *elements[5] = { A_element, B_element, C_element, A_element, B_element };
+    size_t  sizes[3]    = { 3, 0, 2 };
+    bool    result      = false;
+
+    // Construct
+    result = tuple_from_elements_batch(&p_tuples, elements, sizes, 3);
+
+    // Each tuple starts where the last one ends
+    result = result && ( (unsigned char *) p_tuples[1] == (unsigned char *) p_tuples[0] + sizeof(tuple) + 3 * sizeof(void *) );
+    result = result && ( (unsigned char *) p_tuples[2] == (unsigned char *) p_tuples[1] + sizeof(tuple) );
+
+    // Free the batch
+    tuple_destroy_batch(&p_tuples);
+
+    // Return result
+    return result;
+}
+
+bool test_batch_destroy ( void )
+{
+
+    // Initialized data
+    tuple **p_tuples    = 0;
+    tuple  *p_tuple     = 0;
+    void   *elements[3] = { A_element, B_element, C_element };
+    size_t  sizes[1]    = { 3 };
+    bool    result      = false;
+
+    // Construct
+    result = tuple_from_elements_batch(&p_tuples, elements, sizes, 1);
+
+    // Destroying one tuple only clears the caller's pointer
+    p_tuple = p_tuples[0];
+    result  = result && tuple_destroy(&p_tuple) && ( p_tuple == 0 ) && ( tuple_size(p_tuples[0]) == 3 );
+
+    // Free the batch
+    result = result && tuple_destroy_batch(&p_tuples);
+
+    // Return result
+    return result;
+}
+
+bool test_batch_errors ( void )
+{
+
+    // Initialized data
+    tuple **p_tuples    = 0;
+    void   *elements[1] = { A_element };
+    size_t  sizes[1]    = { 1 };
+    bool    result      = true;
+
+    // Null parameters
+    result = result && ( tuple_from_elements_batch(0, elements, sizes, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_from_elements_batch(&p_tuples, 0, sizes, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_from_elements_batch(&p_tuples, elements, 0, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_destroy_batch(&p_tuples) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // Return result
+    return result;
+}
+
+int test_batch ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_from_elements_batch", test_batch_contents() );
+    print_test(name, "tuple_batch_layout"       , test_batch_layout() );
+    print_test(name, "tuple_destroy_member"     , test_batch_destroy() );
+    print_test(name, "tuple_batch_errors"       , test_batch_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_builder_push ( void )
+{
+
+    // Initialized data
+    tuple_builder *p_builder = 0;
+    tuple         *p_tuple   = 0;
+    bool           result    = false;
+
+    // Push 10000 elements one at a time, from a buffer with room for none
+    result = tuple_builder_create(&p_builder, 0);
+    for (size_t i = 0; i < 10000; i++) result = result && tuple_builder_push(p_builder, (void *) i);
+    result = result && ( tuple_builder_size(p_builder) == 10000 );
+
+    // Freeze
+    result = result && tuple_builder_freeze(p_builder, &p_tuple) && ( tuple_size(p_tuple) == 10000 ) && ( tuple_builder_size(p_builder) == 0 );
+    for (size_t i = 0; result && i < 10000; i++) result = ( tuple_data(p_tuple)[i] == (void *) i );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_builder_destroy(&p_builder);
+
+    // Return result
+    return result;
+}
+
+bool test_builder_nulls ( void )
+{
+
+    // Initialized data
+    tuple_builder *p_builder   = 0;
+    tuple         *p_tuple     = 0;
+    void          *elements[3] = { A_element, (void *) 0, C_element };
+    bool           result      = false;
+
+    // [ A, null, C, null ]
+    result = tuple_builder_create(&p_builder, 2) && tuple_builder_push_n(p_builder, elements, 3) && tuple_builder_push(p_builder, (void *) 0);
+    result = result && tuple_builder_freeze(p_builder, &p_tuple) && ( tuple_size(p_tuple) == 4 );
+    result = result && ( tuple_data(p_tuple)[0] == A_element ) && ( tuple_data(p_tuple)[1] == 0 ) && ( tuple_data(p_tuple)[2] == C_element ) && ( tuple_data(p_tuple)[3] == 0 );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_builder_destroy(&p_builder);
+
+    // Return result
+    return result;
+}
+
+bool test_builder_reuse ( void )
+{
+
+    // Initialized data
+    tuple_builder *p_builder = 0;
+    tuple         *p_empty   = 0,
+                  *p_ab      = 0;
+    bool           result    = false;
+
+    // Freezing nothing gives an empty tuple
+    result = tuple_builder_create(&p_builder, 0) && tuple_builder_freeze(p_builder, &p_empty) && tuple_is_empty(p_empty);
+
+    // The builder starts over after a freeze
+    result = result && tuple_builder_push_n(p_builder, (void **) AB_elements, 2) && tuple_builder_freeze(p_builder, &p_ab);
+    result = result && ( tuple_size(p_ab) == 2 ) && ( tuple_data(p_ab)[1] == B_element );
+
+    // Elements left in a builder are freed with it
+    result = result && tuple_builder_push(p_builder, C_element) && tuple_builder_destroy(&p_builder) && ( p_builder == 0 );
+
+    // Clean up
+    tuple_destroy(&p_empty);
+    tuple_destroy(&p_ab);
+
+    // Return result
+    return result;
+}
+
+bool test_builder_errors ( void )
+{
+
+    // Initialized data
+    tuple_builder *p_builder = 0;
+    tuple         *p_tuple   = 0;
+    bool           result    = true;
+
+    // Null parameters
+    result = result && ( tuple_builder_create(0, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_BUILDER );
+    result = result && ( tuple_builder_push(0, A_element) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_BUILDER );
+    result = result && ( tuple_builder_freeze(0, &p_tuple) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_BUILDER );
+    result = result && ( tuple_builder_destroy(&p_builder) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_BUILDER );
+
+    // No elements is fine, a null array of some is not
+    result = result && tuple_builder_create(&p_builder, 0) && tuple_builder_push_n(p_builder, 0, 0);
+    result = result && ( tuple_builder_push_n(p_builder, 0, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_builder_freeze(p_builder, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // Clean up
+    tuple_builder_destroy(&p_builder);
+
+    // Return result
+    return result;
+}
+
+int test_builder ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_builder_push"  , test_builder_push() );
+    print_test(name, "tuple_builder_nulls" , test_builder_nulls() );
+    print_test(name, "tuple_builder_reuse" , test_builder_reuse() );
+    print_test(name, "tuple_builder_errors", test_builder_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_adopt_owned ( void )
+{
+
+    // Initialized data
+    tuple  *p_tuple    = 0;
+    void  **p_elements = malloc(3 * sizeof(void *));
+    bool    result     = false;
+
+    // Error check
+    if ( p_elements == 0 ) return false;
+
+    // [ A, B, C ]
+    p_elements[0] = A_element;
+    p_elements[1] = B_element;
+    p_elements[2] = C_element;
+
+    // The tuple reads the array itself
+    result = tuple_adopt(&p_tuple, p_elements, 3) && ( tuple_size(p_tuple) == 3 ) && ( tuple_data(p_tuple) == (const void *const *) p_elements );
+
+    // The array is freed with the tuple
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_adopt_borrowed ( void )
+{
+
+    // Initialized data
+    tuple *p_tuple     = 0;
+    void  *elements[3] = { A_element, B_element, C_element };
+    void  *p_value     = 0;
+    bool   result      = false;
+
+    // The tuple reads the array on the stack
+    result = tuple_borrow(&p_tuple, elements, 3) && ( tuple_data(p_tuple) == (const void *const *) elements ) && tuple_index(p_tuple, -1, &p_value) && ( p_value == C_element );
+
+    // Destroying the tuple leaves the array alone
+    result = result && tuple_destroy(&p_tuple) && ( elements[0] == A_element );
+
+    // Return result
+    return result;
+}
+
+bool test_adopt_detach ( void )
+{
+
+    // Initialized data
+    tuple  *p_tuple    = 0,
+           *p_shared   = 0,
+           *p_copy     = 0;
+    void  **p_elements = malloc(2 * sizeof(void *)),
+          **p_detached = 0;
+    size_t  size       = 0;
+    bool    result     = false;
+
+    // Error check
+    if ( p_elements == 0 ) return false;
+
+    // [ A, B ]
+    p_elements[0] = A_element;
+    p_elements[1] = B_element;
+
+    // A sole owner gets the same array back
+    result = tuple_adopt(&p_tuple, p_elements, 2) && tuple_detach(&p_tuple, &p_detached, &size);
+    result = result && ( p_tuple == 0 ) && ( p_detached == p_elements ) && ( size == 2 );
+
+    // A shared tuple is copied, and lives on
+    result = result && tuple_adopt(&p_tuple, p_detached, 2) && tuple_retain(p_tuple);
+    p_shared = p_tuple;
+    result = result && tuple_detach(&p_tuple, &p_detached, &size) && ( p_detached != p_elements ) && ( p_detached[1] == B_element ) && ( tuple_data(p_shared)[1] == B_element );
+    free(p_detached);
+    tuple_release(&p_shared);
+
+    // A tuple that stores its own elements is copied
+    result = result && tuple_from_elements(&p_copy, (void **) ABC_elements, 3) && tuple_detach(&p_copy, &p_detached, 0) && ( p_detached[2] == C_element );
+    free(p_detached);
+
+    // Return result
+    return result;
+}
+
+bool test_adopt_errors ( void )
+{
+
+    // Initialized data
+    tuple  *p_tuple     = 0;
+    void   *elements[1] = { A_element };
+    void  **p_detached  = 0;
+    bool    result      = true;
+
+    // Null parameters
+    result = result && ( tuple_adopt(0, elements, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_adopt(&p_tuple, 0, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_borrow(&p_tuple, 0, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_detach(&p_tuple, &p_detached, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // Detaching needs somewhere to put the array
+    result = result && tuple_borrow(&p_tuple, elements, 1) && ( tuple_detach(&p_tuple, 0, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+int test_adopt ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_adopt"       , test_adopt_owned() );
+    print_test(name, "tuple_borrow"      , test_adopt_borrowed() );
+    print_test(name, "tuple_detach"      , test_adopt_detach() );
+    print_test(name, "tuple_adopt_errors", test_adopt_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_with_narrow ( void )
+{
+
+    // Initialized data
+    tuple *p_abc    = 0,
+          *p_result = 0;
+    void  *p_value  = 0;
+    bool   result   = false;
+
+    // [ A, B, C ] -> [ A, X, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    result = tuple_with(p_abc, 1, X_element, &p_result) && ( tuple_size(p_result) == 3 );
+    result = result && tuple_index(p_result, 1, &p_value) && ( p_value == X_element );
+
+    // The original is unchanged
+    result = result && tuple_index(p_abc, 1, &p_value) && ( p_value == B_element );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_result);
+
+    // Return result
+    return result;
+}
+
+bool test_with_wide ( void )
+{
+
+    // Initialized data
+    tuple *p_tuple  = 0,
+          *p_first  = 0,
+          *p_second = 0;
+    void  *p_value  = 0;
+    bool   result   = false;
+
+    // Change element 5000, then the last element of that
+    construct_counting(&p_tuple);
+    result = tuple_with(p_tuple, 5000, X_element, &p_first) && tuple_with(p_first, -1, A_element, &p_second);
+
+    // Each tuple sees its own elements
+    result = result && ( tuple_size(p_second) == PARALLEL_SIZE );
+    result = result && tuple_index(p_tuple , 5000, &p_value) && ( p_value == (void *) 5000 );
+    result = result && tuple_index(p_first , 5000, &p_value) && ( p_value == X_element );
+    result = result && tuple_index(p_first , -1  , &p_value) && ( p_value == (void *) ( PARALLEL_SIZE - 1 ) );
+    result = result && tuple_index(p_second, -1  , &p_value) && ( p_value == A_element );
+    result = result && tuple_index(p_second, 4999, &p_value) && ( p_value == (void *) 4999 );
+
+    // The inline accessors fall back to the library
+    result = result && ( tuple_index_unchecked(p_second, 5000) == X_element ) && tuple_index_fast(p_second, 0, &p_value) && ( p_value == (void *) 0 );
+
+    // Free the originals first. The shared nodes live on
+    tuple_destroy(&p_tuple);
+    tuple_destroy(&p_first);
+    result = result && tuple_index(p_second, 5000, &p_value) && ( p_value == X_element );
+
+    // Clean up
+    tuple_destroy(&p_second);
+
+    // Return result
+    return result;
+}
+
+size_t with_visits = 0;
+bool   with_wrong  = false;
+
+void with_visit ( void *const value, size_t index )
+{
+
+    // Every element but 7 is its index
+    if ( value != ( ( index == 7 ) ? X_element : (void *) index ) ) with_wrong = true;
+
+    // Count the visit
+    with_visits++;
+}
+
+bool test_with_flatten ( void )
+{
+
+    // Initialized data
+    tuple             *p_tuple    = 0,
+                      *p_result   = 0,
+                      *p_flat     = 0;
+    const void *const *p_elements = 0;
+    const void        *_p_slice[PARALLEL_SIZE];
+    unsigned long long a          = 0,
+                       b          = 0;
+    bool               result     = false;
+
+    // Change element 7
+    construct_counting(&p_tuple);
+    result = tuple_with(p_tuple, 7, X_element, &p_result);
+
+    // Iterate the tree in order
+    with_visits = 0;
+    with_wrong  = false;
+    result = result && tuple_foreach(p_result, with_visit) && ( with_visits == PARALLEL_SIZE ) && ( with_wrong == false );
+
+    // Flatten it, and compare it to the same elements in a flat tuple
+    p_elements = tuple_data(p_result);
+    result = result && ( p_elements != 0 ) && ( p_elements == tuple_data(p_result) ) && ( p_elements[7] == X_element );
+    result = result && tuple_from_elements(&p_flat, (void *const *) p_elements, PARALLEL_SIZE) && tuple_equals(p_result, p_flat, 0) && ( tuple_compare(p_flat, p_result, 0) == 0 );
+    result = result && tuple_hash(p_result, 0, &a) && tuple_hash(p_flat, 0, &b) && ( a == b );
+
+    // Slices end at the last element of the flat copy
+    result = result && ( tuple_slice(p_result, _p_slice, 0, PARALLEL_SIZE) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_UPPER_BOUND );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_destroy(&p_result);
+    tuple_destroy(&p_flat);
+
+    // Return result
+    return result;
+}
+
+bool test_with_errors ( void )
+{
+
+    // Initialized data
+    tuple *p_abc    = 0,
+          *p_result = 0;
+    bool   result   = true;
+
+    // [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+
+    // Null parameters, and out of bounds
+    result = result && ( tuple_with(0, 0, X_element, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_with(p_abc, 0, X_element, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_with(p_abc, 3, X_element, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+    result = result && ( tuple_with(p_abc, -4, X_element, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+int test_with ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_with_narrow" , test_with_narrow() );
+    print_test(name, "tuple_with_wide"   , test_with_wide() );
+    print_test(name, "tuple_with_flatten", test_with_flatten() );
+    print_test(name, "tuple_with_errors" , test_with_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_atomic_set ( void )
+{
+
+    // Initialized data
+    tuple              *p_abc      = 0,
+                       *p_adopted  = 0;
+    void               *p_value    = 0,
+                      **p_elements = malloc(3 * sizeof(void *));
+    unsigned long long  a          = 0,
+                        b          = 0;
+    bool                result     = false;
+
+    // Error check
+    if ( p_elements == 0 ) return false;
+
+    // [ A, B, C ] -> [ A, X, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    result = tuple_hash(p_abc, 0, &a) && tuple_set(p_abc, 1, X_element, memory_order_release);
+    result = result && tuple_index_acquire(p_abc, 1, &p_value) && ( p_value == X_element );
+    result = result && tuple_index(p_abc, -2, &p_value) && ( p_value == X_element );
+
+    // The cached hash was dropped
+    result = result && tuple_hash(p_abc, 0, &b) && ( a != b );
+
+    // ... and is not cached again, so a change to an adopted array behind the tuple's back shows
+    p_elements[0] = A_element;
+    p_elements[1] = B_element;
+    p_elements[2] = C_element;
+    result = result && tuple_adopt(&p_adopted, p_elements, 3) && tuple_set(p_adopted, 0, A_element, memory_order_release) && tuple_hash(p_adopted, 0, &b) && ( a == b );
+    p_elements[1] = X_element;
+    result = result && tuple_hash(p_adopted, 0, &b) && ( a != b );
+
+    // [ A, X, C ] -> [ A, B, C ] hashes as it did before
+    result = result && tuple_set(p_abc, 1, B_element, memory_order_release) && tuple_hash(p_abc, 0, &b) && ( a == b );
+    result = result && tuple_set(p_abc, 1, X_element, memory_order_release);
+
+    // [ A, X, C ] -> [ A, X, B ]
+    result = result && tuple_exchange(p_abc, -1, B_element, &p_value, memory_order_acq_rel) && ( p_value == C_element );
+    result = result && tuple_index_acquire(p_abc, 2, &p_value) && ( p_value == B_element );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_adopted);
+
+    // Return result
+    return result;
+}
+
+bool test_atomic_compare_exchange ( void )
+{
+
+    // Initialized data
+    tuple *p_abc    = 0;
+    void  *expected = A_element,
+          *p_value  = 0;
+    bool   result   = false;
+
+    // [ A, B, C ] -> [ X, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    result = tuple_compare_exchange(p_abc, 0, &expected, X_element, memory_order_acq_rel, memory_order_acquire);
+
+    // Fails, and reports the element that is there
+    expected = A_element;
+    result = result && ( tuple_compare_exchange(p_abc, 0, &expected, B_element, memory_order_acq_rel, memory_order_acquire) == false ) && ( expected == X_element );
+    result = result && tuple_index_acquire(p_abc, 0, &p_value) && ( p_value == X_element );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+void *atomic_incrementer ( void *p_parameter )
+{
+
+    // Initialized data
+    tuple *p_tuple  = p_parameter;
+    void  *expected = 0;
+
+    // Increment slot 0, one compare exchange at a time
+    for (size_t i = 0; i < 10000; i++)
+    {
+        tuple_index_acquire(p_tuple, 0, &expected);
+        while ( tuple_compare_exchange(p_tuple, 0, &expected, (char *) expected + 1, memory_order_acq_rel, memory_order_acquire) == false );
+    }
+
+    // Done
+    return 0;
+}
+
+bool test_atomic_threads ( void )
+{
+
+    // Initialized data
+    tuple     *p_tuple     = 0;
+    pthread_t  _threads[4] = { 0 };
+    void      *p_value     = 0;
+    bool       result      = false;
+
+    // Construct [ 0 ]
+    tuple_from_elements(&p_tuple, &p_value, 1);
+
+    // Contend for the one slot
+    for (size_t i = 0; i < 4; i++) pthread_create(&_threads[i], 0, atomic_incrementer, p_tuple);
+    for (size_t i = 0; i < 4; i++) pthread_join(_threads[i], 0);
+
+    // No increment was lost
+    result = tuple_index_acquire(p_tuple, 0, &p_value) && ( p_value == (void *) 40000 );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_atomic_errors ( void )
+{
+
+    // Initialized data
+    tuple *p_abc      = 0,
+          *p_borrowed = 0,
+          *p_wide     = 0,
+          *p_tree     = 0;
+    void  *expected   = A_element,
+          *p_value    = 0;
+    bool   result     = true;
+
+    // [ A, B, C ], a borrowed [ A, B, C ], and a persistent tuple
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    tuple_borrow(&p_borrowed, (void *const *) ABC_elements, 3);
+    construct_counting(&p_wide);
+    tuple_with(p_wide, 0, X_element, &p_tree);
+
+    // Null parameters, out of bounds, and bad memory orders
+    result = result && ( tuple_set(0, 0, X_element, memory_order_relaxed) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_set(p_abc, 3, X_element, memory_order_relaxed) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+    result = result && ( tuple_set(p_abc, 0, X_element, memory_order_acquire) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BAD_ORDER );
+    result = result && ( tuple_exchange(p_abc, -4, X_element, 0, memory_order_relaxed) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+    result = result && ( tuple_compare_exchange(p_abc, 0, 0, X_element, memory_order_seq_cst, memory_order_seq_cst) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+    result = result && ( tuple_compare_exchange(p_abc, 0, &expected, X_element, memory_order_seq_cst, memory_order_release) == false ) && ( tuple_last_status() == TUPLE_STATUS_BAD_ORDER );
+    result = result && ( tuple_index_acquire(p_abc, 0, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+
+    // Borrowed and persistent tuples are read only
+    result = result && ( tuple_set(p_borrowed, 0, X_element, memory_order_relaxed) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_READ_ONLY );
+    result = result && ( tuple_exchange(p_tree, 0, A_element, 0, memory_order_relaxed) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_READ_ONLY );
+    result = result && ( tuple_compare_exchange(p_tree, 0, &expected, A_element, memory_order_seq_cst, memory_order_seq_cst) == false ) && ( tuple_last_status() == TUPLE_STATUS_READ_ONLY );
+
+    // But they can be read
+    result = result && tuple_index_acquire(p_tree, 0, &p_value) && ( p_value == X_element );
+    result = result && tuple_index_acquire(p_borrowed, 2, &p_value) && ( p_value == C_element );
+
+    // Nothing changed
+    result = result && tuple_index(p_abc, 0, &p_value) && ( p_value == A_element );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_borrowed);
+    tuple_destroy(&p_wide);
+    tuple_destroy(&p_tree);
+
+    // Return result
+    return result;
+}
+
+int test_atomic ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_set"             , test_atomic_set() );
+    print_test(name, "tuple_compare_exchange", test_atomic_compare_exchange() );
+    print_test(name, "tuple_atomic_threads"  , test_atomic_threads() );
+    print_test(name, "tuple_atomic_errors"   , test_atomic_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_find_address ( void )
+{
+
+    // Initialized data
+    tuple  *p_tuple         = 0;
+    void   *_p_abc[3]       = { A_element, B_element, C_element },
+           *_p_elements[21] = { 0 };
+    size_t  index           = 0;
+    bool    result          = false;
+
+    // [ A, B, C, A, B, C, ... ], with X in slot 19, past the last full block of 8
+    for (size_t i = 0; i < 21; i++) _p_elements[i] = _p_abc[i % 3];
+    _p_elements[19] = X_element;
+    tuple_from_elements(&p_tuple, _p_elements, 21);
+
+    // First and last
+    result = tuple_find(p_tuple, B_element, &index) && ( index == 1 );
+    result = result && tuple_find_last(p_tuple, B_element, &index) && ( index == 16 );
+    result = result && tuple_find(p_tuple, X_element, &index) && ( index == 19 );
+    result = result && tuple_find_last(p_tuple, X_element, &index) && ( index == 19 );
+    result = result && tuple_find_last(p_tuple, C_element, &index) && ( index == 20 );
+
+    // Absent, which is not an error
+    tuple_clear_status();
+    result = result && ( tuple_find(p_tuple, D_element, &index) == false ) && ( tuple_find_last(p_tuple, D_element, &index) == false );
+    result = result && ( tuple_last_status() == TUPLE_STATUS_OK );
+    result = result && tuple_contains(p_tuple, X_element) && ( tuple_contains(p_tuple, D_element) == false );
+
+    // Count
+    result = result && ( tuple_count(p_tuple, A_element) == 7 ) && ( tuple_count(p_tuple, B_element) == 6 ) && ( tuple_count(p_tuple, C_element) == 7 ) && ( tuple_count(p_tuple, X_element) == 1 ) && ( tuple_count(p_tuple, D_element) == 0 );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_find_wide ( void )
+{
+
+    // Initialized data
+    tuple  *p_tuple = 0,
+           *p_tree  = 0;
+    size_t  index   = 0;
+    bool    result  = false;
+
+    // Every element of a wide tuple, and of a persistent tuple
+    construct_counting(&p_tuple);
+    tuple_with(p_tuple, 9998, X_element, &p_tree);
+    result = true;
+    for (size_t i = 0; i < PARALLEL_SIZE; i += 97) result = result && tuple_find(p_tuple, (void *) i, &index) && ( index == i );
+    result = result && tuple_find(p_tree, X_element, &index) && ( index == 9998 );
+    result = result && ( tuple_contains(p_tree, (void *) 9998) == false ) && ( tuple_count(p_tree, (void *) 9999) == 1 );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_destroy(&p_tree);
+
+    // Return result
+    return result;
+}
+
+size_t find_calls = 0;
+
+bool find_is_c ( void *const value, size_t index )
+{
+
+    // Count the call
+    find_calls++;
+
+    // Unused
+    (void) index;
+
+    // Match C
+    return value == C_element;
+}
+
+bool find_never ( void *const value, size_t index )
+{
+
+    // Count the call
+    find_calls++;
+
+    // Unused
+    (void) value;
+    (void) index;
+
+    // Never match
+    return false;
+}
+
+bool test_find_if ( void )
+{
+
+    // Initialized data
+    tuple  *p_abc  = 0,
+           *p_wide = 0;
+    size_t  index  = 0;
+    bool    result = false;
+
+    // [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    construct_counting(&p_wide);
+
+    // Stops at the first match
+    find_calls = 0;
+    result = tuple_find_if(p_abc, find_is_c, &index) && ( index == 2 ) && ( find_calls == 3 );
+
+    // Every element is tested once
+    find_calls = 0;
+    result = result && ( tuple_find_if(p_wide, find_never, &index) == false ) && ( find_calls == PARALLEL_SIZE );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_wide);
+
+    // Return result
+    return result;
+}
+
+bool test_find_errors ( void )
+{
+
+    // Initialized data
+    tuple  *p_abc  = 0;
+    size_t  index  = 0;
+    bool    result = true;
+
+    // [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+
+    // Null parameters
+    result = result && ( tuple_find(0, A_element, &index) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_find(p_abc, A_element, 0) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+    result = result && ( tuple_find_last(p_abc, A_element, 0) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+    result = result && ( tuple_contains(0, A_element) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_count(0, A_element) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_find_if(p_abc, 0, &index) == false ) && ( tuple_last_status() == TUPLE_STATUS_NO_FUNCTION );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+int test_find ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_find_address", test_find_address() );
+    print_test(name, "tuple_find_wide"   , test_find_wide() );
+    print_test(name, "tuple_find_if"     , test_find_if() );
+    print_test(name, "tuple_find_errors" , test_find_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_gather_mixed ( void )
+{
+
+    // Initialized data
+    tuple            *p_abc         = 0;
+    signed long long  _indices[11]  = { 0, -1, 1, -3, 2, 2, -2, 0, 1, -1, 0 };
+    void             *_p_values[11] = { 0 },
+                     *_p_abc[3]     = { A_element, B_element, C_element };
+    bool              result        = false;
+
+    // [ A, B, C ]
+    tuple_from_elements(&p_abc, _p_abc, 3);
+
+    // Every index, in order
+    result = tuple_index_many(p_abc, _indices, 11, _p_values);
+    for (size_t i = 0; i < 11; i++) result = result && ( _p_values[i] == _p_abc[( _indices[i] + 3 ) % 3] );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+bool test_gather_wide ( void )
+{
+
+    // Initialized data
+    tuple            *p_tuple       = 0,
+                     *p_tree        = 0;
+    signed long long  _indices[37]  = { 0 };
+    void             *_p_values[37] = { 0 };
+    bool              result        = false;
+
+    // Spread across a wide tuple, and a persistent one
+    construct_counting(&p_tuple);
+    tuple_with(p_tuple, 270, X_element, &p_tree);
+    for (size_t i = 0; i < 37; i++) _indices[i] = ( i & 1 ) ? (signed long long) ( i * 270 ) : -(signed long long) ( i * 270 + 1 );
+
+    // Flat
+    result = tuple_index_many(p_tuple, _indices, 37, _p_values);
+    for (size_t i = 0; i < 37; i++) result = result && ( _p_values[i] == (void *) (size_t) ( ( i & 1 ) ? i * 270 : PARALLEL_SIZE - i * 270 - 1 ) );
+
+    // Persistent
+    result = result && tuple_index_many(p_tree, _indices, 37, _p_values) && ( _p_values[1] == X_element ) && ( _p_values[3] == (void *) 810 );
+
+    // Clean up
+    tuple_destroy(&p_tuple);
+    tuple_destroy(&p_tree);
+
+    // Return result
+    return result;
+}
+
+bool test_gather_errors ( void )
+{
+
+    // Initialized data
+    tuple            *p_abc        = 0,
+                     *p_empty      = 0;
+    signed long long  _indices[9]  = { 0, 1, 2, -1, -2, -3, 0, 1, 2 };
+    void             *_p_values[9] = { 0 };
+    bool              result       = true;
+
+    // [ A, B, C ], and [ ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    tuple_construct(&p_empty, 0);
+
+    // Nothing to gather
+    result = result && tuple_index_many(p_abc, 0, 0, 0);
+
+    // Null parameters, and an empty tuple
+    result = result && ( tuple_index_many(0, _indices, 9, _p_values) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_index_many(p_abc, 0, 9, _p_values) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_index_many(p_abc, _indices, 9, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+    result = result && ( tuple_index_many(p_empty, _indices, 9, _p_values) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_EMPTY );
+
+    // One index out of bounds, in a vector lane, then in what is left over
+    _indices[2] = 3;
+    result = result && ( tuple_index_many(p_abc, _indices, 9, _p_values) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+    _indices[2] = 2;
+    _indices[8] = -4;
+    result = result && ( tuple_index_many(p_abc, _indices, 9, _p_values) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+    _indices[8] = (signed long long) ( (unsigned long long) -1 >> 1 );
+    result = result && ( tuple_index_many(p_abc, _indices, 9, _p_values) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_empty);
+
+    // Return result
+    return result;
+}
+
+int test_gather ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_index_many_mixed" , test_gather_mixed() );
+    print_test(name, "tuple_index_many_wide"  , test_gather_wide() );
+    print_test(name, "tuple_index_many_errors", test_gather_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+bool test_combine_concat ( void )
+{
+
+    // Initialized data
+    tuple *p_abc    = 0,
+          *p_ab     = 0,
+          *p_empty  = 0,
+          *p_wide   = 0,
+          *p_tree   = 0,
+          *p_result = 0;
+    void  *p_value  = 0;
+    bool   result   = false;
+
+    // [ A, B, C ], [ A, B ], [ ], and a persistent tuple
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    construct_empty_fromelementsAB_AB(&p_ab);
+    tuple_construct(&p_empty, 0);
+    construct_counting(&p_wide);
+    tuple_with(p_wide, 0, X_element, &p_tree);
+
+    // [ A, B, C ] + [ ] + [ A, B ] -> [ A, B, C, A, B ]
+    result = tuple_concat((const tuple *[]) { p_abc, p_empty, p_ab }, 3, &p_result) && ( tuple_size(p_result) == 5 );
+    result = result && tuple_index(p_result, 2, &p_value) && ( p_value == C_element );
+    result = result && tuple_index(p_result, -1, &p_value) && ( p_value == B_element );
+    tuple_destroy(&p_result);
+
+    // [ A, B ] + tree
+    result = result && tuple_concat((const tuple *[]) { p_ab, p_tree }, 2, &p_result) && ( tuple_size(p_result) == PARALLEL_SIZE + 2 );
+    result = result && tuple_index(p_result, 2, &p_value) && ( p_value == X_element );
+    result = result && tuple_index(p_result, -1, &p_value) && ( p_value == (void *) ( PARALLEL_SIZE - 1 ) );
+    tuple_destroy(&p_result);
+
+    // Nothing
+    result = result && tuple_concat((const tuple *[]) { p_abc }, 0, &p_result) && tuple_is_empty(p_result);
+
+    // Clean up
+    tuple_destroy(&p_result);
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_ab);
+    tuple_destroy(&p_empty);
+    tuple_destroy(&p_wide);
+    tuple_destroy(&p_tree);
+
+    // Return result
+    return result;
+}
+
+bool test_combine_project ( void )
+{
+
+    // Initialized data
+    tuple *p_abc      = 0,
+          *p_result   = 0,
+          *p_expected = 0;
+    bool   result     = false;
+
+    // [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    tuple_from_arguments(&p_expected, 6, C_element, A_element, C_element, B_element, A_element, B_element);
+
+    // [ A, B, C ] -> [ C, A, C, B, A, B ]
+    result = tuple_project(p_abc, (signed long long []) { 2, 0, -1, 1, -3, -2 }, 6, &p_result) && tuple_equals(p_result, p_expected, 0);
+    tuple_destroy(&p_result);
+
+    // No fields
+    result = result && tuple_project(p_abc, 0, 0, &p_result) && tuple_is_empty(p_result);
+    tuple_destroy(&p_result);
+
+    // Out of bounds
+    result = result && ( tuple_project(p_abc, (signed long long []) { 0, 3 }, 2, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR ) && ( p_result == 0 );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_expected);
+
+    // Return result
+    return result;
+}
+
+bool test_combine_project_batch ( void )
+{
+
+    // Initialized data
+    tuple  *p_abc      = 0,
+           *p_ab       = 0,
+           *p_wide     = 0,
+          **pp_results = 0;
+    void   *p_value    = 0;
+    bool    result     = false;
+
+    // [ A, B, C ], [ A, B ], and a wide tuple
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    construct_empty_fromelementsAB_AB(&p_ab);
+    construct_counting(&p_wide);
+
+    // The last and the first of each
+    result = tuple_project_batch((const tuple *[]) { p_abc, p_ab, p_wide }, 3, (signed long long []) { -1, 0 }, 2, &pp_results);
+    result = result && tuple_index(pp_results[0], 0, &p_value) && ( p_value == C_element ) && tuple_index(pp_results[0], 1, &p_value) && ( p_value == A_element );
+    result = result && tuple_index(pp_results[1], 0, &p_value) && ( p_value == B_element );
+    result = result && tuple_index(pp_results[2], 0, &p_value) && ( p_value == (void *) ( PARALLEL_SIZE - 1 ) ) && ( tuple_size(pp_results[2]) == 2 );
+    tuple_destroy_batch(&pp_results);
+
+    // Too far back for [ A, B ]
+    result = result && ( tuple_project_batch((const tuple *[]) { p_abc, p_ab }, 2, (signed long long []) { -3 }, 1, &pp_results) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_ab);
+    tuple_destroy(&p_wide);
+
+    // Return result
+    return result;
+}
+
+bool test_combine_zip ( void )
+{
+
+    // Initialized data
+    tuple *p_abc      = 0,
+          *p_ab       = 0,
+          *p_result   = 0,
+          *p_expected = 0;
+    bool   result     = false;
+
+    // [ A, B, C ], [ A, B ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    construct_empty_fromelementsAB_AB(&p_ab);
+    tuple_from_arguments(&p_expected, 4, A_element, A_element, B_element, B_element);
+
+    // [ A, B, C ] zip [ A, B ] -> [ A, A, B, B ]
+    result = tuple_zip((const tuple *[]) { p_abc, p_ab }, 2, &p_result) && tuple_equals(p_result, p_expected, 0);
+    tuple_destroy(&p_result);
+
+    // Zip of one is a copy, and zip of none is empty
+    result = result && tuple_zip((const tuple *[]) { p_abc }, 1, &p_result) && tuple_equals(p_result, p_abc, 0);
+    tuple_destroy(&p_result);
+    result = result && tuple_zip((const tuple *[]) { p_abc }, 0, &p_result) && tuple_is_empty(p_result);
+
+    // Clean up
+    tuple_destroy(&p_result);
+    tuple_destroy(&p_abc);
+    tuple_destroy(&p_ab);
+    tuple_destroy(&p_expected);
+
+    // Return result
+    return result;
+}
+
+bool test_combine_errors ( void )
+{
+
+    // Initialized data
+    tuple  *p_abc      = 0,
+           *p_result   = 0,
+          **pp_results = 0;
+    bool    result     = true;
+
+    // [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+
+    // Null parameters
+    result = result && ( tuple_concat(0, 1, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_concat((const tuple *[]) { p_abc, 0 }, 2, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_concat((const tuple *[]) { p_abc }, 1, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_project(0, (signed long long []) { 0 }, 1, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_project(p_abc, 0, 1, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_project_batch((const tuple *[]) { 0 }, 1, (signed long long []) { 0 }, 1, &pp_results) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_project_batch(0, 1, (signed long long []) { 0 }, 1, &pp_results) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_zip((const tuple *[]) { 0 }, 1, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_zip((const tuple *[]) { p_abc }, 1, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // Nothing was returned
+    result = result && ( p_result == 0 ) && ( pp_results == 0 );
+
+    // Clean up
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+int test_combine ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_concat"        , test_combine_concat() );
+    print_test(name, "tuple_project"       , test_combine_project() );
+    print_test(name, "tuple_project_batch" , test_combine_project_batch() );
+    print_test(name, "tuple_zip"           , test_combine_zip() );
+    print_test(name, "tuple_combine_errors", test_combine_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+void *pipeline_double ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // 2x
+    return (void *) ( (size_t) value * 2 );
+}
+
+void *pipeline_increment ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // x + 1
+    return (void *) ( (size_t) value + 1 );
+}
+
+bool pipeline_multiple_of_3 ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) index;
+
+    // Keep multiples of 3
+    return ( (size_t) value % 3 ) == 0;
+}
+
+bool pipeline_even_index ( void *const value, size_t index )
+{
+
+    // Unused
+    (void) value;
+
+    // Keep even positions in the source
+    return ( index & 1 ) == 0;
+}
+
+bool test_pipeline_collect ( void )
+{
+
+    // Initialized data
+    tuple          *p_tuple    = 0,
+                   *p_result   = 0;
+    tuple_pipeline *p_pipeline = 0;
+    void           *p_value    = 0;
+    bool            result     = false;
+
+    // x -> 2x -> multiples of 3 -> + 1
+    construct_counting(&p_tuple);
+    result = tuple_pipeline_create(&p_pipeline, p_tuple) && tuple_pipeline_map(p_pipeline, pipeline_double) && tuple_pipeline_filter(p_pipeline, pipeline_multiple_of_3) && tuple_pipeline_map(p_pipeline, pipeline_increment);
+
+    // The pipeline keeps the source
+    tuple_release(&p_tuple);
+
+    // 2x is a multiple of 3 when x is, so every third element survives, as 6k + 1
+    result = result && tuple_pipeline_collect(p_pipeline, &p_result) && ( tuple_size(p_result) == ( PARALLEL_SIZE + 2 ) / 3 );
+    result = result && tuple_index(p_result, 0, &p_value) && ( p_value == (void *) 1 );
+    result = result && tuple_index(p_result, -1, &p_value) && ( p_value == (void *) ( ( PARALLEL_SIZE - 1 ) / 3 * 6 + 1 ) );
+    tuple_destroy(&p_result);
+
+    // Run it again, with one more filter on the source index
+    result = result && tuple_pipeline_filter(p_pipeline, pipeline_even_index) && tuple_pipeline_collect(p_pipeline, &p_result) && ( tuple_size(p_result) == ( PARALLEL_SIZE + 5 ) / 6 );
+    result = result && tuple_index(p_result, 1, &p_value) && ( p_value == (void *) 13 );
+
+    // Clean up
+    tuple_destroy(&p_result);
+    tuple_pipeline_destroy(&p_pipeline);
+
+    // Return result
+    return result;
+}
+
+bool test_pipeline_map_only ( void )
+{
+
+    // Initialized data
+    tuple          *p_abc      = 0,
+                   *p_result   = 0;
+    tuple_pipeline *p_pipeline = 0;
+    void           *p_value    = 0;
+    bool            result     = false;
+
+    // Ten stages, past the initial room for stages
+    construct_empty_fromelementsABC_ABC(&p_abc);
+    result = tuple_pipeline_create(&p_pipeline, p_abc);
+    for (size_t i = 0; i < 10; i++) result = result && tuple_pipeline_map(p_pipeline, pipeline_increment);
+
+    // Every element moves ten bytes along
+    result = result && tuple_pipeline_collect(p_pipeline, &p_result) && ( tuple_size(p_result) == 3 );
+    result = result && tuple_index(p_result, 2, &p_value) && ( p_value == (void *) ( (char *) C_element + 10 ) );
+
+    // Clean up
+    tuple_destroy(&p_result);
+    tuple_pipeline_destroy(&p_pipeline);
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+void *pipeline_sum ( void *const left, void *const right )
+{
+
+    // left + right
+    return (void *) ( (size_t) left + (size_t) right );
+}
+
+bool test_pipeline_reduce ( void )
+{
+
+    // Initialized data
+    tuple          *p_tuple    = 0,
+                   *p_result   = 0;
+    tuple_pipeline *p_pipeline = 0;
+    void           *p_value    = 0;
+    size_t          expected   = 0;
+    bool            result     = false;
+
+    // Sum of 2x over multiples of 3
+    construct_counting(&p_tuple);
+    for (size_t i = 0; i < PARALLEL_SIZE; i += 3) expected += i * 2;
+    result = tuple_pipeline_create(&p_pipeline, p_tuple) && tuple_pipeline_filter(p_pipeline, pipeline_multiple_of_3) && tuple_pipeline_map(p_pipeline, pipeline_double);
+    result = result && tuple_pipeline_reduce(p_pipeline, pipeline_sum, (void *) 0, &p_value) && ( p_value == (void *) expected );
+    tuple_pipeline_destroy(&p_pipeline);
+
+    // Nothing kept gives the identity, and an empty tuple
+    result = result && tuple_pipeline_create(&p_pipeline, p_tuple) && tuple_pipeline_map(p_pipeline, pipeline_increment) && tuple_pipeline_filter(p_pipeline, pipeline_multiple_of_3) && tuple_pipeline_filter(p_pipeline, pipeline_even_index) && tuple_pipeline_map(p_pipeline, pipeline_increment) && tuple_pipeline_filter(p_pipeline, pipeline_multiple_of_3);
+    result = result && tuple_pipeline_reduce(p_pipeline, pipeline_sum, X_element, &p_value) && ( p_value == X_element );
+    result = result && tuple_pipeline_collect(p_pipeline, &p_result) && tuple_is_empty(p_result);
+
+    // Clean up
+    tuple_destroy(&p_result);
+    tuple_pipeline_destroy(&p_pipeline);
+    tuple_destroy(&p_tuple);
+
+    // Return result
+    return result;
+}
+
+bool test_pipeline_errors ( void )
+{
+
+    // Initialized data
+    tuple          *p_abc      = 0,
+                   *p_result   = 0;
+    tuple_pipeline *p_pipeline = 0;
+    void           *p_value    = 0;
+    bool            result     = true;
+
+    // [ A, B, C ]
+    construct_empty_fromelementsABC_ABC(&p_abc);
+
+    // Null parameters
+    result = result && ( tuple_pipeline_create(0, p_abc) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_PIPELINE );
+    result = result && ( tuple_pipeline_create(&p_pipeline, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_pipeline_map(0, pipeline_double) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_PIPELINE );
+    result = result && ( tuple_pipeline_filter(0, pipeline_even_index) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_PIPELINE );
+    result = result && ( tuple_pipeline_collect(0, &p_result) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_PIPELINE );
+    result = result && ( tuple_pipeline_reduce(0, pipeline_sum, 0, &p_value) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_PIPELINE );
+    result = result && ( tuple_pipeline_destroy(0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_PIPELINE );
+
+    // Null callbacks, and null returns
+    result = result && tuple_pipeline_create(&p_pipeline, p_abc);
+    result = result && ( tuple_pipeline_map(p_pipeline, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_FUNCTION );
+    result = result && ( tuple_pipeline_filter(p_pipeline, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_FUNCTION );
+    result = result && ( tuple_pipeline_reduce(p_pipeline, 0, 0, &p_value) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_FUNCTION );
+    result = result && ( tuple_pipeline_reduce(p_pipeline, pipeline_sum, 0, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+    result = result && ( tuple_pipeline_collect(p_pipeline, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // With no stages, collecting copies the source
+    result = result && tuple_pipeline_collect(p_pipeline, &p_result) && tuple_equals(p_result, p_abc, 0);
+
+    // Clean up
+    tuple_destroy(&p_result);
+    tuple_pipeline_destroy(&p_pipeline);
+    tuple_destroy(&p_abc);
+
+    // Return result
+    return result;
+}
+
+int test_pipeline ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_pipeline_collect" , test_pipeline_collect() );
+    print_test(name, "tuple_pipeline_map_only", test_pipeline_map_only() );
+    print_test(name, "tuple_pipeline_reduce"  , test_pipeline_reduce() );
+    print_test(name, "tuple_pipeline_errors"  , test_pipeline_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+#define SORT_SIZE 40000
+
+tuple *sort_tuples[SORT_SIZE];
+
+int sort_construct ( size_t count )
+{
+
+    // [ i * 7919 % 97, i % 5, i ]
+    for (size_t i = 0; i < count; i++)
+        if ( tuple_from_arguments(&sort_tuples[i], 3, (void *) ( i * 7919 % 97 ), (void *) ( i % 5 ), (void *) i) == 0 ) return 0;
+
+    // Success
+    return 1;
+}
+
+void sort_destruct ( size_t count )
+{
+
+    // Free each tuple
+    for (size_t i = 0; i < count; i++) tuple_destroy(&sort_tuples[i]);
+
+    // Done
+    return;
+}
+
+size_t sort_element ( size_t row, signed long long index )
+{
+
+    // Initialized data
+    void *p_value = 0;
+
+    // Get the element
+    tuple_index(sort_tuples[row], index, &p_value);
+
+    // Done
+    return (size_t) p_value;
+}
+
+int sort_compare_reverse ( const void *const a, const void *const b )
+{
+
+    // Larger values first
+    return ( (size_t) b > (size_t) a ) - ( (size_t) b < (size_t) a );
+}
+
+bool sort_is_sorted ( size_t count, signed long long first, bool first_descending, signed long long second, bool second_descending )
+{
+
+    // Each adjacent pair
+    for (size_t i = 1; i < count; i++)
+    {
+
+        // Initialized data
+        size_t a = sort_element(i - 1, first),
+               b = sort_element(i, first);
+
+        // Out of order on the first key
+        if ( first_descending ? ( a < b ) : ( a > b ) ) return false;
+
+        // Ordered on the first key
+        if ( a != b ) continue;
+
+        // Initialized data
+        a = sort_element(i - 1, second);
+        b = sort_element(i, second);
+
+        // Out of order on the second key
+        if ( second_descending ? ( a < b ) : ( a > b ) ) return false;
+
+        // Equal keys keep the order they were in
+        if ( a == b && sort_element(i - 1, -1) > sort_element(i, -1) ) return false;
+    }
+
+    // Sorted
+    return true;
+}
+
+bool test_sort_address ( size_t count )
+{
+
+    // Initialized data
+    tuple_sort_key _keys[] = { { .index = 0 }, { .index = 1, .descending = true } };
+    bool           result  = sort_construct(count);
+
+    // One key, ties keep their order
+    result = result && tuple_array_sort(sort_tuples, count, _keys, 1) && sort_is_sorted(count, 0, false, 2, false);
+
+    // Two keys, the second reversed
+    result = result && tuple_array_sort(sort_tuples, count, _keys, 2) && sort_is_sorted(count, 0, false, 1, true);
+
+    // Back to the original order, by the last element
+    _keys[0].index = -1;
+    result = result && tuple_array_sort(sort_tuples, count, _keys, 1) && ( sort_element(0, -1) == 0 ) && ( sort_element(count - 1, -1) == count - 1 );
+
+    // Clean up
+    sort_destruct(count);
+
+    // Return result
+    return result;
+}
+
+bool test_sort_comparator ( size_t count )
+{
+
+    // Initialized data
+    tuple_sort_key _keys[] = { { .index = 1, .pfn_compare = sort_compare_reverse }, { .index = 0 } };
+    bool           result  = sort_construct(count);
+
+    // A comparator on the first key, by address on the second
+    result = result && tuple_array_sort(sort_tuples, count, _keys, 2) && sort_is_sorted(count, 1, true, 0, false);
+
+    // A reversed comparator orders ascending. The last sort's order breaks ties
+    _keys[0].descending = true;
+    result = result && tuple_array_sort(sort_tuples, count, _keys, 1) && sort_is_sorted(count, 1, false, 0, false);
+
+    // Clean up
+    sort_destruct(count);
+
+    // Return result
+    return result;
+}
+
+bool test_sort_errors ( void )
+{
+
+    // Initialized data
+    tuple_sort_key _keys[17] = { { .index = 0 } };
+    bool           result    = sort_construct(4);
+
+    // Null parameters
+    result = result && ( tuple_array_sort(0, 4, _keys, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_array_sort(sort_tuples, 4, 0, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_KEYS );
+    result = result && ( tuple_array_sort(sort_tuples, 4, _keys, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_KEYS );
+    result = result && ( tuple_array_sort(sort_tuples, 4, _keys, 17) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_TOO_MANY_ELEMENTS );
+
+    // A key past the end of the tuples
+    _keys[0].index = 3;
+    result = result && ( tuple_array_sort(sort_tuples, 4, _keys, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+
+    // A missing tuple
+    _keys[0].index = 0;
+    tuple_destroy(&sort_tuples[3]);
+    result = result && ( tuple_array_sort(sort_tuples, 4, _keys, 1) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // No tuples is already sorted
+    result = result && tuple_array_sort(sort_tuples, 0, _keys, 1);
+
+    // Clean up
+    sort_destruct(3);
+
+    // Return result
+    return result;
+}
+
+int test_sort ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_array_sort_address_small"   , test_sort_address(100) );
+    print_test(name, "tuple_array_sort_address"         , test_sort_address(SORT_SIZE) );
+    print_test(name, "tuple_array_sort_comparator_small", test_sort_comparator(100) );
+    print_test(name, "tuple_array_sort_comparator"      , test_sort_comparator(SORT_SIZE) );
+    print_test(name, "tuple_array_sort_errors"          , test_sort_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
+#define JOIN_LEFT_SIZE  50000
+#define JOIN_RIGHT_SIZE 20000
+
+tuple *join_left[JOIN_LEFT_SIZE];
+tuple *join_right[JOIN_RIGHT_SIZE];
+
+int join_construct ( size_t left_count, size_t left_keys, size_t right_count )
+{
+
+    // Left tuples are [ i % left_keys + 1, i ]
+    for (size_t i = 0; i < left_count; i++)
+        if ( tuple_from_arguments(&join_left[i], 2, (void *) ( i % left_keys + 1 ), (void *) i) == 0 ) return 0;
+
+    // Right tuples are [ X, j, j / 2 + 1 ], so every key is on two right tuples
+    for (size_t j = 0; j < right_count; j++)
+        if ( tuple_from_arguments(&join_right[j], 3, X_element, (void *) j, (void *) ( j / 2 + 1 )) == 0 ) return 0;
+
+    // Success
+    return 1;
+}
+
+void join_destruct ( size_t left_count, size_t right_count )
+{
+
+    // Free each tuple
+    for (size_t i = 0; i < left_count; i++) tuple_destroy(&join_left[i]);
+    for (size_t j = 0; j < right_count; j++) tuple_destroy(&join_right[j]);
+
+    // Done
+    return;
+}
+
+bool join_check ( tuple **pp_results, size_t count, size_t right_count, size_t *p_matched, size_t *p_sum )
+{
+
+    // Initialized data
+    size_t matched = 0,
+           sum     = 0;
+
+    // Each result
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // Initialized data
+        const void *const *p_elements = tuple_data(pp_results[i]);
+
+        // [ key, i, "R", j, key ], or [ key, i, 0, 0, 0 ] when nothing matched
+        if ( tuple_size(pp_results[i]) != 5 ) return false;
+
+        // Padding
+        if ( p_elements[2] == 0 )
+        {
+            if ( p_elements[3] != 0 || p_elements[4] != 0 ) return false;
+            if ( (size_t) p_elements[0] <= right_count / 2 ) return false;
+            continue;
+        }
+
+        // The keys match
+        if ( p_elements[0] != p_elements[4] || p_elements[2] != X_element ) return false;
+
+        // Accumulate
+        matched++;
+        sum += (size_t) p_elements[1] + (size_t) p_elements[3];
+    }
+
+    // Return the totals
+    *p_matched = matched;
+    *p_sum     = sum;
+
+    // Success
+    return true;
+}
+
+bool test_join_inner ( size_t left_count, size_t left_keys, size_t right_count, bool parallel )
+{
+
+    // Initialized data
+    tuple            **pp_results  = 0;
+    signed long long   _left_key[] = { 0 },
+                       _right_key[] = { -1 };
+    size_t             count       = 0,
+                       matched     = 0,
+                       sum         = 0,
+                       expected    = 0,
+                       expected_sum = 0;
+    bool               result      = join_construct(left_count, left_keys, right_count);
+
+    // Every left tuple whose key is on the right matches the two right tuples with that key
+    for (size_t i = 0; i < left_count; i++)
+    {
+
+        // Initialized data
+        size_t key = i % left_keys + 1;
+
+        // No match
+        if ( key > right_count / 2 ) continue;
+
+        // Two matches
+        expected     += 2;
+        expected_sum += 2 * i + ( key - 1 ) * 4 + 1;
+    }
+
+    // Join
+    result = result && tuple_join((const tuple *const *) join_left, left_count, (const tuple *const *) join_right, right_count, _left_key, _right_key, 1, TUPLE_JOIN_INNER, parallel, &pp_results, &count);
+    result = result && ( count == expected ) && join_check(pp_results, count, right_count, &matched, &sum) && ( matched == expected ) && ( sum == expected_sum );
+
+    // Clean up
+    if ( pp_results ) tuple_destroy_batch(&pp_results);
+    join_destruct(left_count, right_count);
+
+    // Return result
+    return result;
+}
+
+bool test_join_left ( bool parallel )
+{
+
+    // Initialized data
+    tuple            **pp_results   = 0;
+    signed long long   _left_key[]  = { 0 },
+                       _right_key[] = { 2 };
+    size_t             count        = 0,
+                       matched      = 0,
+                       sum          = 0,
+                       padded       = 0;
+    bool               result       = join_construct(JOIN_LEFT_SIZE, 30000, JOIN_RIGHT_SIZE);
+
+    // Keys 1 to 10000 are on the right. Keys 10001 to 30000 are not
+    result = result && tuple_join((const tuple *const *) join_left, JOIN_LEFT_SIZE, (const tuple *const *) join_right, JOIN_RIGHT_SIZE, _left_key, _right_key, 1, TUPLE_JOIN_LEFT, parallel, &pp_results, &count);
+    for (size_t i = 0; i < JOIN_LEFT_SIZE; i++) padded += ( i % 30000 + 1 > JOIN_RIGHT_SIZE / 2 );
+    result = result && join_check(pp_results, count, JOIN_RIGHT_SIZE, &matched, &sum) && ( count == matched + padded ) && ( matched == 2 * ( JOIN_LEFT_SIZE - padded ) );
+
+    // Clean up
+    if ( pp_results ) tuple_destroy_batch(&pp_results);
+    join_destruct(JOIN_LEFT_SIZE, JOIN_RIGHT_SIZE);
+
+    // Return result
+    return result;
+}
+
+bool test_join_keys ( void )
+{
+
+    // Initialized data
+    tuple            **pp_results    = 0,
+                      *_p_left[3]    = { 0 },
+                      *_p_right[3]   = { 0 };
+    signed long long   _left_keys[]  = { 0, 1 },
+                       _right_keys[] = { -1, 0 };
+    size_t             count         = 0;
+    bool               result        = true;
+
+    // [ A, B ], [ A, C ], [ B, A ] against [ B, D, A ], [ C, D, A ], [ B, X, B ]
+    result = result && tuple_from_arguments(&_p_left[0], 2, A_element, B_element) && tuple_from_arguments(&_p_left[1], 2, A_element, C_element) && tuple_from_arguments(&_p_left[2], 2, B_element, A_element);
+    result = result && tuple_from_arguments(&_p_right[0], 3, B_element, D_element, A_element) && tuple_from_arguments(&_p_right[1], 3, C_element, D_element, A_element) && tuple_from_arguments(&_p_right[2], 3, B_element, X_element, B_element);
+
+    // Both positions have to match. [ B, A ] is the reverse of a match, so it is not one
+    result = result && tuple_join((const tuple *const *) _p_left, 3, (const tuple *const *) _p_right, 3, _left_keys, _right_keys, 2, TUPLE_JOIN_INNER, false, &pp_results, &count) && ( count == 2 );
+    for (size_t i = 0; result && i < count; i++)
+    {
+
+        // Initialized data
+        const void *const *p_elements = tuple_data(pp_results[i]);
+
+        // [ A, B, B, D, A ] or [ A, C, C, D, A ]
+        result = ( tuple_size(pp_results[i]) == 5 ) && ( p_elements[0] == p_elements[4] ) && ( p_elements[1] == p_elements[2] );
+    }
+
+    // Clean up
+    if ( pp_results ) tuple_destroy_batch(&pp_results);
+    for (size_t i = 0; i < 3; i++) tuple_destroy(&_p_left[i]), tuple_destroy(&_p_right[i]);
+
+    // Return result
+    return result;
+}
+
+bool test_join_errors ( void )
+{
+
+    // Initialized data
+    tuple            **pp_results = 0;
+    signed long long   _key[]     = { 0 },
+                       _far[]     = { 5 };
+    size_t             count      = 0;
+    bool               result     = join_construct(4, 4, 4);
+
+    // Null parameters
+    result = result && ( tuple_join(0, 4, (const tuple *const *) join_right, 4, _key, _key, 1, TUPLE_JOIN_INNER, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, 0, 4, _key, _key, 1, TUPLE_JOIN_INNER, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_ELEMENTS );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, 0, _key, 1, TUPLE_JOIN_INNER, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_KEYS );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _key, _key, 0, TUPLE_JOIN_INNER, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_KEYS );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _key, _key, 1, (tuple_join_mode) 7, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BAD_JOIN );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _key, _key, 1, TUPLE_JOIN_INNER, false, 0, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _key, _key, 1, TUPLE_JOIN_INNER, false, &pp_results, 0) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_VALUE );
+
+    // A key position past the end of the tuples
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _far, _key, 1, TUPLE_JOIN_INNER, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _key, _far, 1, TUPLE_JOIN_LEFT, true, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_BOUNDS_ERROR );
+
+    // A missing tuple
+    tuple_destroy(&join_left[3]);
+    result = result && ( tuple_join((const tuple *const *) join_left, 4, (const tuple *const *) join_right, 4, _key, _key, 1, TUPLE_JOIN_INNER, false, &pp_results, &count) == 0 ) && ( tuple_last_status() == TUPLE_STATUS_NO_TUPLE );
+
+    // Nothing on either side is an empty result
+    result = result && tuple_join(0, 0, 0, 0, _key, _key, 1, TUPLE_JOIN_LEFT, false, &pp_results, &count) && ( count == 0 ) && tuple_destroy_batch(&pp_results);
+
+    // Nothing on the right keeps every left tuple as it is
+    result = result && tuple_join((const tuple *const *) join_left, 3, 0, 0, _key, _key, 1, TUPLE_JOIN_LEFT, false, &pp_results, &count) && ( count == 3 ) && ( tuple_size(pp_results[0]) == 2 ) && tuple_destroy_batch(&pp_results);
+
+    // Clean up
+    join_destruct(3, 4);
+
+    // Return result
+    return result;
+}
+
+int test_join ( char *name )
+{
+
+    // Output
+    log_scenario("%s\n", name);
+
+    // Tests
+    print_test(name, "tuple_join_inner_small"   , test_join_inner(100, 10, 12, false) );
+    print_test(name, "tuple_join_inner"         , test_join_inner(JOIN_LEFT_SIZE, 15000, JOIN_RIGHT_SIZE, false) );
+    print_test(name, "tuple_join_inner_parallel", test_join_inner(JOIN_LEFT_SIZE, 15000, JOIN_RIGHT_SIZE, true) );
+    print_test(name, "tuple_join_left"          , test_join_left(false) );
+    print_test(name, "tuple_join_left_parallel" , test_join_left(true) );
+    print_test(name, "tuple_join_keys"          , test_join_keys() );
+    print_test(name, "tuple_join_errors"        , test_join_errors() );
+
+    // Output
+    print_final_summary();
+
+    // Success
+    return 1;
+}
+
 int print_time_pretty ( double seconds )
 {
 